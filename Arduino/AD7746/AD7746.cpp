@@ -7,6 +7,7 @@
 //
 // Changelog:
 //     2012-04-01 - initial release
+//     2026-10-19 - add continuous conversion streaming (initializeStream/pollStream)
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -132,3 +133,61 @@ void AD7746::writeCapDacARegister(uint8_t data) {
 void AD7746::writeCapDacBRegister(uint8_t data) {
     I2Cdev::writeByte(devAddr, AD7746_RA_CAP_DAC_B, data);
 }
+
+// continuous conversion streaming
+
+/** Start continuous conversion for pollStream().
+ * CAP_SETUP, VT_SETUP, EXC_SETUP and CONFIGURATION are written in one
+ * auto-increment burst, with the mode bits in CONFIGURATION forced to
+ * continuous conversion. With both AD7746_CAPEN and AD7746_VTEN set the
+ * device alternates between the capacitive and voltage/temperature channels
+ * by itself; with only one enabled it converts that channel back to back.
+ * @param capSetup CAP_SETUP value (e.g. AD7746_CAPEN)
+ * @param vtSetup VT_SETUP value (e.g. AD7746_VTEN | AD7746_VTMD_INT_TEMP), 0 for capacitance only
+ * @param excSetup EXC_SETUP value
+ * @param configuration CONFIGURATION value selecting the conversion times (AD7746_VTF_*, AD7746_CAPF_*)
+ * @see pollStream()
+ */
+void AD7746::initializeStream(uint8_t capSetup, uint8_t vtSetup, uint8_t excSetup, uint8_t configuration) {
+    buffer[0] = capSetup;
+    buffer[1] = vtSetup;
+    buffer[2] = excSetup;
+    buffer[3] = (configuration & ~((1 << AD7746_MD_BIT_2) | (1 << AD7746_MD_BIT_1) | (1 << AD7746_MD_BIT_0))) | AD7746_MD_CONTINUOUS_CONVERSION;
+    I2Cdev::writeBytes(devAddr, AD7746_RA_CAP_SETUP, 4, buffer);
+}
+
+/** Collect any finished conversions into a ring buffer.
+ * STATUS and both data registers are read in a single 7-byte burst. The
+ * RDYCAP and RDYVT bits are low while a channel holds a result that has not
+ * been read yet, so the status in the same burst tells exactly which of the
+ * data fields are new; reading them resets the bits. Call at least once per
+ * conversion time (or from the RDY pin interrupt) to catch every sample.
+ * @param ring Ring buffer to append new samples to
+ * @param timestamp Current time, e.g. micros(), stored with each new sample
+ * @return Number of new samples found (0-2)
+ * @see initializeStream()
+ */
+uint8_t AD7746::pollStream(AD7746SampleRing *ring, uint32_t timestamp) {
+    if (I2Cdev::readBytes(devAddr, AD7746_RA_STATUS, 7, buffer) != 7) return 0;
+
+    uint8_t count = 0;
+    for (uint8_t channel = AD7746_CHANNEL_CAP; channel <= AD7746_CHANNEL_VT; channel++) {
+        uint8_t rdyBit = channel == AD7746_CHANNEL_CAP ? AD7746_RDYCAP_BIT : AD7746_RDYVT_BIT;
+        if (buffer[0] & (1 << rdyBit)) continue;
+        count++;
+
+        uint16_t next = ring -> head + 1;
+        if (next == ring -> size) next = 0;
+        if (next == ring -> tail) {
+            ring -> dropped++;
+            continue;
+        }
+        uint8_t *data = buffer + 1 + channel * 3;
+        AD7746Sample *s = &ring -> samples[ring -> head];
+        s -> value = ((uint32_t)data[0] << 16) | ((uint32_t)data[1] << 8) | (uint32_t)data[2];
+        s -> timestamp = timestamp;
+        s -> channel = channel;
+        ring -> head = next;
+    }
+    return count;
+}
@@ -7,6 +7,7 @@
 //
 // Changelog:
 //     2012-04-01 - initial release
+//     2026-10-19 - add continuous conversion streaming (initializeStream/pollStream)
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -157,6 +158,23 @@ THE SOFTWARE.
 
 #define AD7746_DAC_COEFFICIENT           0.13385826771654F // 17pF/127
 
+#define AD7746_CHANNEL_CAP               0
+#define AD7746_CHANNEL_VT                1
+
+typedef struct {
+    uint32_t value;             // raw 24-bit conversion result
+    uint32_t timestamp;         // time of the pollStream() call that found it
+    uint8_t channel;            // AD7746_CHANNEL_CAP or AD7746_CHANNEL_VT
+} AD7746Sample;
+
+typedef struct {
+    AD7746Sample *samples;      // caller-supplied storage
+    uint16_t size;              // number of entries in samples
+    volatile uint16_t head;     // next entry written by pollStream()
+    volatile uint16_t tail;     // next entry to be consumed by the caller
+    uint32_t dropped;           // samples lost because the ring was full
+} AD7746SampleRing;
+
 
 
 class AD7746 {
@@ -176,6 +194,10 @@ class AD7746 {
         void writeConfigurationRegister(uint8_t data);
         void writeCapDacARegister(uint8_t data);
         void writeCapDacBRegister(uint8_t data);
+
+        // continuous conversion streaming
+        void initializeStream(uint8_t capSetup, uint8_t vtSetup, uint8_t excSetup, uint8_t configuration);
+        uint8_t pollStream(AD7746SampleRing *ring, uint32_t timestamp);
         
 
     private:
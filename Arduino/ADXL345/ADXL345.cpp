@@ -5,6 +5,8 @@
 //
 // Changelog:
 //     2011-07-31 - initial release
+//     2026-10-19 - add watermark-driven FIFO streaming (initializeStream/drainFIFO)
+//     2026-10-19 - initialize() runs a config table, no read-modify-write of POWER_CTL
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -31,12 +33,15 @@ THE SOFTWARE.
 */
 
 #include "ADXL345.h"
+#include "I2CdevConfig.h"
 
 /** Default constructor, uses default I2C address.
  * @see ADXL345_DEFAULT_ADDRESS
  */
 ADXL345::ADXL345() {
     devAddr = ADXL345_DEFAULT_ADDRESS;
+    streamSynced = false;
+    streamOverflows = 0;
 }
 
 /** Specific address constructor.
@@ -47,17 +52,24 @@ ADXL345::ADXL345() {
  */
 ADXL345::ADXL345(uint8_t address) {
     devAddr = address;
+    streamSynced = false;
+    streamOverflows = 0;
 }
 
+static const I2CdevConfigStep initializeProfile[] PROGMEM = {
+    I2CDEV_CONFIG_WRITE(ADXL345_RA_POWER_CTL, 0), // reset all power settings
+    I2CDEV_CONFIG_WRITE(ADXL345_RA_POWER_CTL, 1 << ADXL345_PCTL_AUTOSLEEP_BIT),
+    I2CDEV_CONFIG_WRITE(ADXL345_RA_POWER_CTL, (1 << ADXL345_PCTL_AUTOSLEEP_BIT) | (1 << ADXL345_PCTL_MEASURE_BIT)),
+    I2CDEV_CONFIG_END
+};
+
 /** Power on and prepare for general usage.
  * This will activate the accelerometer, so be sure to adjust the power settings
  * after you call this method if you want it to enter standby mode, or another
  * less demanding mode of operation.
  */
 void ADXL345::initialize() {
-    I2Cdev::writeByte(devAddr, ADXL345_RA_POWER_CTL, 0); // reset all power settings
-    setAutoSleepEnabled(true);
-    setMeasureEnabled(true);
+    I2CdevConfig::apply(devAddr, initializeProfile);
 }
 
 /** Verify the I2C connection.
@@ -1666,3 +1678,100 @@ uint8_t ADXL345::getFIFOLength() {
     I2Cdev::readBits(devAddr, ADXL345_RA_FIFO_STATUS, ADXL345_FIFOSTAT_LENGTH_BIT, ADXL345_FIFOSTAT_LENGTH_LENGTH, buffer);
     return buffer[0];
 }
+
+// FIFO streaming
+
+/** Configure the FIFO for continuous capture with a watermark.
+ * The FIFO is flushed (bypass mode), the output data rate and watermark are
+ * set, stream mode is entered and the WATERMARK interrupt is enabled, so the
+ * INT pin (see setIntWatermarkPin()) goes active once the FIFO holds
+ * watermark samples. Call drainFIFO() from the interrupt handler's deferred
+ * work or poll it at least once per (32 - watermark) sample periods.
+ * @param rate Output data rate (ADXL345_RATE_3200 .. ADXL345_RATE_0P10)
+ * @param watermark FIFO level that raises the WATERMARK interrupt (1-31)
+ * @see drainFIFO()
+ * @see ADXL345_RATE_3200
+ */
+void ADXL345::initializeStream(uint8_t rate, uint8_t watermark) {
+    setFIFOMode(ADXL345_FIFO_MODE_BYPASS);
+    setRate(rate);
+    setFIFOSamples(watermark);
+    setFIFOMode(ADXL345_FIFO_MODE_STREAM);
+    setIntWatermarkEnabled(true);
+
+    // 3200 Hz = 312.5 us = 5000/16 us, doubling for each lower rate code
+    streamPeriod = 5000UL << (ADXL345_RATE_3200 - (rate & 0x0F));
+    streamFraction = 0;
+    streamSynced = false;
+    streamOverflows = 0;
+}
+
+/** Move every sample queued in the FIFO into a ring buffer.
+ * Each FIFO entry is popped by its own 6-byte DATAX0..DATAZ1 burst, so a
+ * drain of N samples costs N + 1 transactions (one FIFO_STATUS read first);
+ * the I2C start/address overhead already exceeds the 5 us the device needs
+ * between FIFO reads. Samples are timestamped from the configured output
+ * data rate: the newest one is assumed to have been taken at timestamp, and
+ * consecutive drains continue one evenly spaced timeline, slewed gently
+ * towards the caller's clock and restarted after a FIFO overflow or a jump
+ * of more than one period.
+ * @param ring Caller-supplied ring buffer; samples that do not fit are counted in ring->dropped
+ * @param timestamp Current time in microseconds (e.g. micros() taken just before the call)
+ * @return Number of samples read from the FIFO
+ * @see initializeStream()
+ */
+uint8_t ADXL345::drainFIFO(ADXL345SampleRing *ring, uint32_t timestamp) {
+    uint8_t count = getFIFOLength();
+    if (count == 0) return 0;
+
+    // stream mode overwrites the oldest entries once full, so the timeline may have a gap
+    if (count >= ADXL345_FIFO_DEPTH) {
+        streamOverflows++;
+        streamSynced = false;
+    }
+
+    uint32_t periodUs = streamPeriod >> 4;
+    uint32_t first = timestamp - (count - 1) * periodUs;
+    if (streamSynced) {
+        int32_t error = (int32_t)(first - streamTimestamp);
+        if (error > (int32_t)periodUs || error < -(int32_t)periodUs) {
+            streamSynced = false;
+        } else {
+            streamTimestamp += error / 8;
+        }
+    }
+    if (!streamSynced) {
+        streamTimestamp = first;
+        streamFraction = 0;
+        streamSynced = true;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 6, buffer);
+        uint16_t next = ring -> head + 1;
+        if (next == ring -> size) next = 0;
+        if (next == ring -> tail) {
+            ring -> dropped++;
+        } else {
+            ADXL345Sample *s = &ring -> samples[ring -> head];
+            s -> x = (((int16_t)buffer[1]) << 8) | buffer[0];
+            s -> y = (((int16_t)buffer[3]) << 8) | buffer[2];
+            s -> z = (((int16_t)buffer[5]) << 8) | buffer[4];
+            s -> timestamp = streamTimestamp;
+            ring -> head = next;
+        }
+        uint32_t fraction = streamFraction + streamPeriod;
+        streamTimestamp += fraction >> 4;
+        streamFraction = fraction & 0x0F;
+    }
+    return count;
+}
+
+/** Get number of FIFO overflows seen by drainFIFO().
+ * An overflow means at least one sample was overwritten in the device
+ * before it could be read.
+ * @return Overflow count since initializeStream()
+ */
+uint32_t ADXL345::getStreamOverflows() {
+    return streamOverflows;
+}
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2011-07-31 - initial release
+//     2026-10-19 - add watermark-driven FIFO streaming (initializeStream/drainFIFO)
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -163,6 +164,21 @@ THE SOFTWARE.
 #define ADXL345_FIFOSTAT_LENGTH_BIT         5
 #define ADXL345_FIFOSTAT_LENGTH_LENGTH      6
 
+#define ADXL345_FIFO_DEPTH          32
+
+typedef struct {
+    int16_t x, y, z;
+    uint32_t timestamp;         // microseconds, reconstructed from the output data rate
+} ADXL345Sample;
+
+typedef struct {
+    ADXL345Sample *samples;     // caller-supplied storage
+    uint16_t size;              // number of entries in samples
+    volatile uint16_t head;     // next entry written by drainFIFO()
+    volatile uint16_t tail;     // next entry to be consumed by the caller
+    uint32_t dropped;           // samples lost because the ring was full
+} ADXL345SampleRing;
+
 class ADXL345 {
     public:
         ADXL345();
@@ -353,9 +369,19 @@ class ADXL345 {
         bool getFIFOTriggerOccurred();
         uint8_t getFIFOLength();
 
+        // FIFO streaming
+        void initializeStream(uint8_t rate, uint8_t watermark);
+        uint8_t drainFIFO(ADXL345SampleRing *ring, uint32_t timestamp);
+        uint32_t getStreamOverflows();
+
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        uint32_t streamPeriod;      // sample period in 1/16 us
+        uint32_t streamTimestamp;   // timestamp of the next sample, us
+        uint8_t streamFraction;     // 1/16 us remainder of streamTimestamp
+        bool streamSynced;
+        uint32_t streamOverflows;
 };
 
 #endif /* _ADXL345_H_ */
@@ -0,0 +1,101 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for ADXL345 FIFO streaming
+// Captures at the full 3200 Hz output data rate using the FIFO watermark
+// interrupt, one FIFO_STATUS read plus one 6-byte burst per sample
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include "Wire.h"
+
+// I2Cdev and ADXL345 must be installed as libraries, or else the .cpp/.h files
+// for both classes must be in the include path of your project
+#include "I2Cdev.h"
+#include "ADXL345.h"
+
+ADXL345 accel;
+
+// connect ADXL345 INT1 to this pin (must support external interrupts)
+#define INTERRUPT_PIN 2
+#define WATERMARK 16
+#define RING_SIZE 128
+
+ADXL345Sample samples[RING_SIZE];
+ADXL345SampleRing ring = { samples, RING_SIZE, 0, 0, 0 };
+
+volatile bool watermarkInterrupt = false;
+void watermarkReady() {
+    watermarkInterrupt = true;
+}
+
+uint32_t samplesThisSecond = 0;
+uint32_t lastReport = 0;
+uint32_t lastTimestamp = 0;
+uint32_t maxGap = 0;
+
+void setup() {
+    // 400 kHz is needed to keep up with 3200 Hz
+    Wire.begin();
+    Wire.setClock(400000);
+    Serial.begin(115200);
+
+    Serial.println("Initializing I2C devices...");
+    accel.initialize();
+    Serial.println(accel.testConnection() ? "ADXL345 connection successful" : "ADXL345 connection failed");
+
+    accel.setIntWatermarkPin(0); // INT1
+    accel.initializeStream(ADXL345_RATE_3200, WATERMARK);
+    pinMode(INTERRUPT_PIN, INPUT);
+    attachInterrupt(digitalPinToInterrupt(INTERRUPT_PIN), watermarkReady, RISING);
+}
+
+void loop() {
+    // drain on interrupt, or poll in case an edge was missed while draining
+    if (watermarkInterrupt || digitalRead(INTERRUPT_PIN)) {
+        watermarkInterrupt = false;
+        accel.drainFIFO(&ring, micros());
+    }
+
+    // consume samples; a real logger would write them to SD card here
+    while (ring.tail != ring.head) {
+        ADXL345Sample *s = &samples[ring.tail];
+        if (lastTimestamp && s -> timestamp - lastTimestamp > maxGap) maxGap = s -> timestamp - lastTimestamp;
+        lastTimestamp = s -> timestamp;
+        samplesThisSecond++;
+        ring.tail = (ring.tail + 1) % RING_SIZE;
+    }
+
+    if (millis() - lastReport >= 1000) {
+        lastReport = millis();
+        Serial.print("samples/s:\t"); Serial.print(samplesThisSecond);
+        Serial.print("\tmax gap us:\t"); Serial.print(maxGap);
+        Serial.print("\tdropped:\t"); Serial.print(ring.dropped);
+        Serial.print("\tFIFO overflows:\t"); Serial.println(accel.getStreamOverflows());
+        samplesThisSecond = 0;
+        maxGap = 0;
+    }
+}
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2016-01-02 - initial release based on AK8975 code
+//     2026-10-19 - add split-phase/continuous measurement and integer ASA scaling
 //
 
 /* ============================================
@@ -38,6 +39,9 @@ THE SOFTWARE.
  */
 AK8963::AK8963() {
     devAddr = AK8963_DEFAULT_ADDRESS;
+    resolution = AK8963_RES_14_BIT;
+    overflows = 0;
+    asaScale[0] = asaScale[1] = asaScale[2] = 256;
 }
 
 /** Specific address constructor.
@@ -47,6 +51,9 @@ AK8963::AK8963() {
  */
 AK8963::AK8963(uint8_t address) {
     devAddr = address;
+    resolution = AK8963_RES_14_BIT;
+    overflows = 0;
+    asaScale[0] = asaScale[1] = asaScale[2] = 256;
 }
 
 /** Power on and prepare for general usage.
@@ -136,6 +143,7 @@ uint8_t AK8963::getResolution() {
 }
 void AK8963::setResolution(uint8_t res) {
     I2Cdev::writeBit(devAddr, AK8963_RA_CNTL1, AK8963_CNTL1_RES_BIT, res);
+    resolution = res;
 }
 
 // CNTL2 register
@@ -187,3 +195,121 @@ uint8_t AK8963::getAdjustmentZ() {
 void AK8963::setAdjustmentZ(uint8_t z) {
     I2Cdev::writeByte(devAddr, AK8963_RA_ASAZ, z);
 }
+
+// split-phase measurement
+
+/** Trigger a single measurement and return immediately.
+ * CNTL1 is written whole, using the resolution last set through
+ * setResolution(), so no read-modify-write is needed. The result is ready
+ * about 7.2 ms later (see isReady()).
+ * @see isReady()
+ * @see fetchMeasurement()
+ */
+void AK8963::startMeasurement() {
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, (resolution << AK8963_CNTL1_RES_BIT) | AK8963_MODE_SINGLE);
+}
+
+/** Check whether a new measurement is available.
+ * @return True if ST1 DRDY is set
+ */
+bool AK8963::isReady() {
+    I2Cdev::readByte(devAddr, AK8963_RA_ST1, buffer);
+    return buffer[0] & (1 << AK8963_ST1_DRDY_BIT);
+}
+
+/** Read the finished measurement.
+ * HXL through ST2 are read in one transaction; reading ST2 releases the
+ * data registers for the next measurement and tells whether the result is
+ * valid.
+ * @param x Raw X-axis reading
+ * @param y Raw Y-axis reading
+ * @param z Raw Z-axis reading
+ * @return False if the sensor reported a magnetic overflow (HOFL)
+ */
+bool AK8963::fetchMeasurement(int16_t *x, int16_t *y, int16_t *z) {
+    uint8_t data[7];
+    if (I2Cdev::readBytes(devAddr, AK8963_RA_HXL, 7, data) != 7) return false;
+    *x = (((int16_t)data[1]) << 8) | data[0];
+    *y = (((int16_t)data[3]) << 8) | data[2];
+    *z = (((int16_t)data[5]) << 8) | data[4];
+    if (data[6] & (1 << AK8963_ST2_HOFL_BIT)) {
+        overflows++;
+        return false;
+    }
+    return true;
+}
+
+// continuous measurement
+
+/** Start free-running measurements.
+ * @param mode AK8963_MODE_CONTINUOUS_8HZ or AK8963_MODE_CONTINUOUS_100HZ
+ * @see readContinuous()
+ */
+void AK8963::startContinuous(uint8_t mode) {
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, AK8963_MODE_POWERDOWN);
+    delay(1); // at least 100 us in power-down between modes
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, (resolution << AK8963_CNTL1_RES_BIT) | mode);
+}
+
+/** Read the newest measurement in continuous mode, if there is one.
+ * ST1 through ST2 are read in a single 8-byte transaction, so polling
+ * costs one bus transfer whether or not new data is waiting.
+ * @param x Raw X-axis reading
+ * @param y Raw Y-axis reading
+ * @param z Raw Z-axis reading
+ * @return True if a new, non-overflowed measurement was read
+ * @see getOverflowCount()
+ */
+bool AK8963::readContinuous(int16_t *x, int16_t *y, int16_t *z) {
+    uint8_t data[8];
+    if (I2Cdev::readBytes(devAddr, AK8963_RA_ST1, 8, data) != 8) return false;
+    if (!(data[0] & (1 << AK8963_ST1_DRDY_BIT))) return false;
+    *x = (((int16_t)data[2]) << 8) | data[1];
+    *y = (((int16_t)data[4]) << 8) | data[3];
+    *z = (((int16_t)data[6]) << 8) | data[5];
+    if (data[7] & (1 << AK8963_ST2_HOFL_BIT)) {
+        overflows++;
+        return false;
+    }
+    return true;
+}
+
+/** Number of measurements discarded because of magnetic overflow (HOFL).
+ * @return Overflow count since construction
+ */
+uint32_t AK8963::getOverflowCount() {
+    return overflows;
+}
+
+// sensitivity adjustment
+
+/** Read the factory sensitivity adjustment (ASA) values from fuse ROM.
+ * The values are kept as integer scale factors for applyAdjustment(), so
+ * this only needs to be called once, e.g. after initialize(). Leaves the
+ * device powered down.
+ */
+void AK8963::loadAdjustment() {
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, AK8963_MODE_FUSEROM);
+    delay(10);
+    if (I2Cdev::readBytes(devAddr, AK8963_RA_ASAX, 3, buffer) == 3) {
+        asaScale[0] = buffer[0] + 128;
+        asaScale[1] = buffer[1] + 128;
+        asaScale[2] = buffer[2] + 128;
+    }
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, AK8963_MODE_POWERDOWN);
+}
+
+/** Apply the sensitivity adjustment loaded by loadAdjustment() in place.
+ * Hadj = H * ((ASA - 128) / 256 + 1), computed as H * (ASA + 128) / 256 and
+ * clamped to the int16_t range (16-bit readings can exceed it).
+ * @param x X-axis reading to adjust
+ * @param y Y-axis reading to adjust
+ * @param z Z-axis reading to adjust
+ */
+void AK8963::applyAdjustment(int16_t *x, int16_t *y, int16_t *z) {
+    int16_t *v[3] = { x, y, z };
+    for (uint8_t i = 0; i < 3; i++) {
+        int32_t h = ((int32_t)*v[i] * asaScale[i]) / 256;
+        *v[i] = h > 32767 ? 32767 : (h < -32768 ? -32768 : h);
+    }
+}
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2016-01-02 - initial release based on AK8975 code
+//     2026-10-19 - add split-phase/continuous measurement and integer ASA scaling
 //
 
 /* ============================================
@@ -142,10 +143,27 @@ class AK8963 {
         uint8_t getAdjustmentZ();
         void setAdjustmentZ(uint8_t z);
 
+        // split-phase measurement
+        void startMeasurement();
+        bool isReady();
+        bool fetchMeasurement(int16_t *x, int16_t *y, int16_t *z);
+
+        // continuous measurement
+        void startContinuous(uint8_t mode);
+        bool readContinuous(int16_t *x, int16_t *y, int16_t *z);
+        uint32_t getOverflowCount();
+
+        // sensitivity adjustment
+        void loadAdjustment();
+        void applyAdjustment(int16_t *x, int16_t *y, int16_t *z);
+
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
         uint8_t mode;
+        uint8_t resolution;     // CNTL1 BIT, kept so mode writes need no read-back
+        uint16_t asaScale[3];   // (ASA + 128), applied as raw * scale / 256
+        uint32_t overflows;
 };
 
 #endif /* _AK8963_H_ */
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2011-08-27 - initial release
+//     2026-10-19 - add split-phase measurement and integer ASA scaling
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -37,6 +38,7 @@ THE SOFTWARE.
  */
 AK8975::AK8975() {
     devAddr = AK8975_DEFAULT_ADDRESS;
+    asaScale[0] = asaScale[1] = asaScale[2] = 256;
 }
 
 /** Specific address constructor.
@@ -46,6 +48,7 @@ AK8975::AK8975() {
  */
 AK8975::AK8975(uint8_t address) {
     devAddr = address;
+    asaScale[0] = asaScale[1] = asaScale[2] = 256;
 }
 
 /** Power on and prepare for general usage.
@@ -196,3 +199,70 @@ void AK8975::setAdjustmentZ(uint8_t z) {
     delay(10);
     I2Cdev::writeByte(devAddr, AK8975_RA_ASAZ, z);
 }
+
+// split-phase measurement
+
+/** Trigger a single measurement and return immediately.
+ * The result is ready about 7.3 ms later (see isReady()); getHeading() does
+ * the same but blocks for 10 ms.
+ * @see isReady()
+ * @see fetchMeasurement()
+ */
+void AK8975::startMeasurement() {
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
+}
+
+/** Check whether the measurement started by startMeasurement() is done.
+ * @return True if ST1 DRDY is set
+ */
+bool AK8975::isReady() {
+    I2Cdev::readByte(devAddr, AK8975_RA_ST1, buffer);
+    return buffer[0] & (1 << AK8975_ST1_DRDY_BIT);
+}
+
+/** Read the finished measurement.
+ * HXL through ST2 are read in one transaction; reading ST2 also tells
+ * whether the result is valid.
+ * @param x Raw X-axis reading
+ * @param y Raw Y-axis reading
+ * @param z Raw Z-axis reading
+ * @return False if the sensor reported a magnetic overflow or data error
+ */
+bool AK8975::fetchMeasurement(int16_t *x, int16_t *y, int16_t *z) {
+    uint8_t data[7];
+    if (I2Cdev::readBytes(devAddr, AK8975_RA_HXL, 7, data) != 7) return false;
+    *x = (((int16_t)data[1]) << 8) | data[0];
+    *y = (((int16_t)data[3]) << 8) | data[2];
+    *z = (((int16_t)data[5]) << 8) | data[4];
+    return !(data[6] & ((1 << AK8975_ST2_HOFL_BIT) | (1 << AK8975_ST2_DERR_BIT)));
+}
+
+// sensitivity adjustment
+
+/** Read the factory sensitivity adjustment (ASA) values from fuse ROM.
+ * The values are kept as integer scale factors for applyAdjustment(), so
+ * this only needs to be called once, e.g. after initialize(). Leaves the
+ * device powered down.
+ */
+void AK8975::loadAdjustment() {
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_FUSEROM);
+    delay(10);
+    if (I2Cdev::readBytes(devAddr, AK8975_RA_ASAX, 3, buffer) == 3) {
+        asaScale[0] = buffer[0] + 128;
+        asaScale[1] = buffer[1] + 128;
+        asaScale[2] = buffer[2] + 128;
+    }
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_POWERDOWN);
+}
+
+/** Apply the sensitivity adjustment loaded by loadAdjustment() in place.
+ * Hadj = H * ((ASA - 128) / 256 + 1), computed as H * (ASA + 128) / 256.
+ * @param x X-axis reading to adjust
+ * @param y Y-axis reading to adjust
+ * @param z Z-axis reading to adjust
+ */
+void AK8975::applyAdjustment(int16_t *x, int16_t *y, int16_t *z) {
+    *x = ((int32_t)*x * asaScale[0]) / 256;
+    *y = ((int32_t)*y * asaScale[1]) / 256;
+    *z = ((int32_t)*z * asaScale[2]) / 256;
+}
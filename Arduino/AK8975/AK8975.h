@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2011-08-27 - initial release
+//     2026-10-19 - add split-phase measurement and integer ASA scaling
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -126,10 +127,20 @@ class AK8975 {
         uint8_t getAdjustmentZ();
         void setAdjustmentZ(uint8_t z);
 
+        // split-phase measurement
+        void startMeasurement();
+        bool isReady();
+        bool fetchMeasurement(int16_t *x, int16_t *y, int16_t *z);
+
+        // sensitivity adjustment
+        void loadAdjustment();
+        void applyAdjustment(int16_t *x, int16_t *y, int16_t *z);
+
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
         uint8_t mode;
+        uint16_t asaScale[3];   // (ASA + 128), applied as raw * scale / 256
 };
 
 #endif /* _AK8975_H_ */
\ No newline at end of file
@@ -0,0 +1,78 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for AK8975 class
+// Non-blocking measurement: the main loop keeps running while the sensor
+// converts, and the result is picked up once ST1 DRDY is set
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include "Wire.h"
+
+// I2Cdev and AK8975 must be installed as libraries, or else the .cpp/.h files
+// for both classes must be in the include path of your project
+#include "I2Cdev.h"
+#include "AK8975.h"
+
+AK8975 mag;
+
+int16_t mx, my, mz;
+uint32_t idleLoops = 0;
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    Wire.begin();
+    Serial.begin(38400);
+
+    Serial.println("Initializing I2C devices...");
+    mag.initialize();
+    Serial.println(mag.testConnection() ? "AK8975 connection successful" : "AK8975 connection failed");
+
+    // read the factory sensitivity adjustment once
+    mag.loadAdjustment();
+    mag.startMeasurement();
+}
+
+void loop() {
+    if (mag.isReady()) {
+        bool valid = mag.fetchMeasurement(&mx, &my, &mz);
+        mag.startMeasurement();
+        mag.applyAdjustment(&mx, &my, &mz);
+
+        Serial.print("mag:\t");
+        Serial.print(mx); Serial.print("\t");
+        Serial.print(my); Serial.print("\t");
+        Serial.print(mz); Serial.print("\t");
+        Serial.print(valid ? "ok" : "overflow"); Serial.print("\t");
+        Serial.println(idleLoops);
+        idleLoops = 0;
+    } else {
+        // other work goes here instead of waiting in delay(10)
+        idleLoops++;
+    }
+}
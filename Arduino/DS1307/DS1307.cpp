@@ -8,6 +8,7 @@
 //     2011-11-13 - initial release
 //     2012-03-29 - alain.spineux@gmail.com: bug in getHours24() 
 //                  am/pm is bit 0x20 instead of 0x80
+//     2026-10-19 - initialize() registers the 100 kHz bus clock limit with I2Cdev
 //
 
 /* ============================================
@@ -57,6 +58,7 @@ DS1307::DS1307(uint8_t address) {
  * variable so that it isn't accidentally changed by the setHour*() methods.
  */
 void DS1307::initialize() {
+    I2Cdev::setDeviceClock(devAddr, DS1307_MAX_CLOCK_HZ);
     getMode(); // automatically sets internal "mode12" member variable
     getClockRunning(); // automatically sets internal "clockHalt" member variable
 }
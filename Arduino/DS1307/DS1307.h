@@ -45,6 +45,7 @@ THE SOFTWARE.
 
 #define DS1307_ADDRESS              0x68 // this device only has one address
 #define DS1307_DEFAULT_ADDRESS      0x68
+#define DS1307_MAX_CLOCK_HZ         100000 // standard mode only
 
 #define DS1307_RA_SECONDS           0x00
 #define DS1307_RA_MINUTES           0x01
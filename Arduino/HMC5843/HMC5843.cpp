@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - readSample() rejects repeated samples and keeps its polling phase
+//     2026-10-19 - add continuous-mode sampler gated on DRDY (initializeSampler/readSample)
 //     2011-08-22 - initial release
 
 /* ============================================
@@ -31,12 +33,20 @@ THE SOFTWARE.
 */
 
 #include "HMC5843.h"
+#ifndef ARDUINO
+    // micros() for platforms without the Arduino core
+    #include "I2CdevPort.h"
+#endif
+
+#include <string.h>
 
 /** Default constructor, uses default I2C address.
  * @see HMC5843_DEFAULT_ADDRESS
  */
 HMC5843::HMC5843() {
     devAddr = HMC5843_DEFAULT_ADDRESS;
+    drdyInterrupt = false;
+    drdyPending = false;
 }
 
 /** Specific address constructor.
@@ -46,6 +56,8 @@ HMC5843::HMC5843() {
  */
 HMC5843::HMC5843(uint8_t address) {
     devAddr = address;
+    drdyInterrupt = false;
+    drdyPending = false;
 }
 
 /** Power on and prepare for general usage.
@@ -351,3 +363,89 @@ uint8_t HMC5843::getIDC() {
     I2Cdev::readByte(devAddr, HMC5843_RA_ID_C, buffer);
     return buffer[0];
 }
+
+// continuous-mode sampler
+
+/** Start continuous measurement for readSample().
+ * In continuous mode the device measures at the configured data output rate
+ * by itself, so no MODE register write is needed per sample (unlike
+ * getHeading() in single mode). The output period of the given rate is
+ * kept to pace readSample() when it polls the STATUS register.
+ * @param rate Data output rate (HMC5843_RATE_*)
+ * @param useInterrupt True if dataReadyInterrupt() will be called on each
+ *        falling edge of the DRDY pin; readSample() then gates on that instead
+ *        of reading the STATUS register
+ * @see readSample()
+ */
+void HMC5843::initializeSampler(uint8_t rate, bool useInterrupt) {
+    drdyInterrupt = useInterrupt;
+    drdyPending = false;
+    // 0.5 Hz ... 50 Hz, the reserved rate 7 is treated as the fastest
+    static const uint32_t periods[7] = { 2000000, 1000000, 500000, 200000, 100000, 50000, 20000 };
+    samplePeriod = periods[rate < 7 ? rate : 6];
+    sampleTime = micros() - samplePeriod;
+    memset(lastSample, 0, sizeof(lastSample));
+    sampleRepeated = false;
+    setDataRate(rate);
+    setMode(HMC5843_MODE_CONTINUOUS);
+}
+
+/** Flag that a new measurement is waiting.
+ * Call this from the interrupt handler for the DRDY pin, which is pulled
+ * low for 250 us each time the data output registers are updated.
+ * @see initializeSampler()
+ */
+void HMC5843::dataReadyInterrupt() {
+    drdyPending = true;
+}
+
+/** Read the newest measurement, if there is one.
+ * New data is detected from the DRDY pin (see dataReadyInterrupt()) or,
+ * without the pin, from the RDY bit in the STATUS register. Reading the
+ * data registers does not clear RDY (only the device's next update does),
+ * so STATUS is not read until one output period has passed since the last
+ * sample was due, and data that equals the previous sample is taken as not
+ * updated yet and rejected. The device clock is not exactly the nominal
+ * rate: a slow device is caught by that comparison, which also re-anchors
+ * the polling phase to the update, while a fast one can occasionally have a
+ * sample skipped. A new sample that happens to repeat the previous one in
+ * all three axes is skipped as well. Use the DRDY pin where every sample
+ * matters. When STATUS shows nothing new no data is read. The six data
+ * registers are always read in one burst, which also releases the output
+ * lock (see getLockStatus()); the address pointer rolls back from DATAY_L
+ * to DATAX_H, so the status cannot be included in the same burst.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return True if a new sample was read, false if none was ready
+ * @see initializeSampler()
+ * @see HMC5843_RA_STATUS
+ */
+bool HMC5843::readSample(int16_t *x, int16_t *y, int16_t *z) {
+    if (drdyInterrupt) {
+        if (!drdyPending) return false;
+        drdyPending = false;
+        if (I2Cdev::readBytes(devAddr, HMC5843_RA_DATAX_H, 6, buffer) != 6) return false;
+    } else {
+        uint32_t now = micros();
+        if (now - sampleTime < samplePeriod) return false;
+        if (I2Cdev::readByte(devAddr, HMC5843_RA_STATUS, buffer) != 1) return false;
+        if (!(buffer[0] & (1 << HMC5843_STATUS_READY_BIT))) return false;
+        if (I2Cdev::readBytes(devAddr, HMC5843_RA_DATAX_H, 6, buffer) != 6) return false;
+        if (memcmp(buffer, lastSample, 6) == 0) {
+            sampleRepeated = true; // RDY still set from the previous update
+            return false;
+        }
+        memcpy(lastSample, buffer, 6);
+        // advance by the period so that poll latency does not add up; after
+        // a repeated read the update was just seen, and a caller that fell a
+        // whole period behind starts over
+        sampleTime += samplePeriod;
+        if (sampleRepeated || now - sampleTime >= samplePeriod) sampleTime = now;
+        sampleRepeated = false;
+    }
+    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
+    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    return true;
+}
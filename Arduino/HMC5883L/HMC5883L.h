@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - readSample() rejects repeated samples and keeps its polling phase
+//     2026-10-19 - add continuous-mode sampler gated on DRDY (initializeSampler/readSample)
 //     2012-06-12 - fixed swapped Y/Z axes
 //     2011-08-22 - small Doxygen comment fixes
 //     2011-07-31 - initial release
@@ -139,10 +141,21 @@ class HMC5883L {
         uint8_t getIDB();
         uint8_t getIDC();
 
+        // continuous-mode sampler
+        void initializeSampler(uint8_t rate, bool useInterrupt=false);
+        void dataReadyInterrupt();
+        bool readSample(int16_t *x, int16_t *y, int16_t *z);
+
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
         uint8_t mode;
+        bool drdyInterrupt;             // gate readSample() on dataReadyInterrupt() instead of STATUS
+        volatile bool drdyPending;
+        uint32_t samplePeriod;          // output period in us, paces STATUS polling
+        uint32_t sampleTime;            // micros() the last sample read by polling was due
+        uint8_t lastSample[6];          // its raw data, to tell a repeated read from a new sample
+        bool sampleRepeated;            // the last STATUS poll found that sample again
 };
 
 #endif /* _HMC5883L_H_ */
@@ -3,6 +3,7 @@
 // 2013-06-05 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-19 - add writeMasked() for precomputed field masks (see I2CdevRegister.h)
 //      2021-09-28 - allow custom Wire object as transaction function argument
 //      2020-01-20 - hardija : complete support for Teensy 3.x
 //      2015-10-30 - simondlevy : support i2c_t3 for Teensy3.1
@@ -48,6 +49,9 @@ THE SOFTWARE.
 
 #include "I2Cdev.h"
 
+// whole words per Wire request, so a word never straddles two chunks
+#define I2CDEVLIB_WORD_CHUNK (I2CDEVLIB_WIRE_BUFFER_LENGTH & ~1)
+
 #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE
 
     #ifdef I2CDEV_IMPLEMENTATION_WARNINGS
@@ -90,6 +94,70 @@ THE SOFTWARE.
 
 #endif
 
+#if I2CDEV_DEVICE_CLOCKS > 0
+    struct I2CdevDeviceClock {
+        void *wireObj;
+        uint32_t clockHz;       // 0 = free entry
+        I2CdevDeviceStats stats;
+        uint8_t devAddr;
+    };
+
+    static I2CdevDeviceClock deviceClocks[I2CDEV_DEVICE_CLOCKS];
+    static uint8_t deviceClockCount = 0;
+    static uint32_t baseClock = 0;     // from setBusClock(), 0 = left to the sketch
+    static uint32_t currentClock = 0;   // last clock set on currentWire, 0 = unknown
+    static void *currentWire = 0;
+
+    static I2CdevDeviceClock *findDevice(uint8_t devAddr, void *wireObj) {
+        for (uint8_t i = 0; i < I2CDEV_DEVICE_CLOCKS; i++) {
+            I2CdevDeviceClock *d = &deviceClocks[i];
+            if (d -> clockHz && d -> devAddr == devAddr && d -> wireObj == wireObj) return d;
+        }
+        return 0;
+    }
+
+    /** Set the bus clock, unless it is already running at that speed.
+     * Does nothing with I2C implementations that cannot change the clock
+     * after setup (Wire before Arduino 1.5.7, SBWire, NBWire, Teensy i2c_t3).
+     */
+    static void applyClock(uint32_t clockHz, void *wireObj) {
+        if (clockHz == currentClock && wireObj == currentWire) return;
+        #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 157
+            ((TwoWire *)(wireObj ? wireObj : &Wire)) -> setClock(clockHz);
+        #elif I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
+            Fastwire::setClock(clockHz);
+        #endif
+        currentClock = clockHz;
+        currentWire = wireObj;
+    }
+
+    /** Get the clock for a device's transactions: the bus clock, lowered to
+     * the device's limit if it has a slower one.
+     * @return Clock in Hz, 0 if setBusClock() has not been called
+     */
+    static uint32_t deviceClock(I2CdevDeviceClock *d) {
+        return d && d -> clockHz < baseClock ? d -> clockHz : baseClock;
+    }
+
+    /** Switch to the clock of the device about to be addressed.
+     * The bus clock is left alone until setBusClock() has been called.
+     * @return The device's entry, or 0 if it has none
+     */
+    static I2CdevDeviceClock *beginDevice(uint8_t devAddr, void *wireObj) {
+        if (!deviceClockCount) return 0;
+        I2CdevDeviceClock *d = findDevice(devAddr, wireObj);
+        if (baseClock) applyClock(deviceClock(d), wireObj);
+        return d;
+    }
+
+    static void endDevice(I2CdevDeviceClock *d, uint16_t bytes, uint32_t t0) {
+        if (!d) return;
+        d -> stats.transactions++;
+        d -> stats.bytes += bytes;
+        d -> stats.micros += micros() - t0;
+    }
+#endif
+
 /** Default constructor.
  */
 I2Cdev::I2Cdev() {
@@ -219,6 +287,10 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
 
     int8_t count = 0;
     uint32_t t1 = millis();
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        I2CdevDeviceClock *device = beginDevice(devAddr, wireObj);
+        uint32_t t0 = device ? micros() : 0;
+    #endif
 
     #if (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE)
         TwoWire *useWire = &Wire;
@@ -316,6 +388,9 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
         Serial.print(count, DEC);
         Serial.println(" read).");
     #endif
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        endDevice(device, count > 0 ? count : 0, t0);
+    #endif
 
     return count;
 }
@@ -341,6 +416,10 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
 
     int8_t count = 0;
     uint32_t t1 = millis();
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        I2CdevDeviceClock *device = beginDevice(devAddr, wireObj);
+        uint32_t t0 = device ? micros() : 0;
+    #endif
 
 #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE
         TwoWire *useWire = &Wire;
@@ -352,12 +431,12 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
             // I2C/TWI subsystem uses internal buffer that breaks with large data requests
             // so if user requests more than I2CDEVLIB_WIRE_BUFFER_LENGTH bytes, we have to do it in
             // smaller chunks instead of all at once
-            for (uint8_t k = 0; k < length * 2; k += min(length * 2, I2CDEVLIB_WIRE_BUFFER_LENGTH)) {
+            for (uint16_t k = 0; k < length * 2; k += I2CDEVLIB_WORD_CHUNK) {
                 useWire->beginTransmission(devAddr);
                 useWire->send(regAddr);
                 useWire->endTransmission();
                 useWire->beginTransmission(devAddr);
-                useWire->requestFrom(devAddr, (uint8_t)(length * 2)); // length=words, this wants bytes
+                useWire->requestFrom(devAddr, (uint8_t)min((int)length * 2 - k, I2CDEVLIB_WORD_CHUNK)); // length=words, this wants bytes
     
                 bool msb = true; // starts with MSB, then LSB
                 for (; useWire->available() && count < length && (timeout == 0 || millis() - t1 < timeout);) {
@@ -385,12 +464,12 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
             // I2C/TWI subsystem uses internal buffer that breaks with large data requests
             // so if user requests more than I2CDEVLIB_WIRE_BUFFER_LENGTH bytes, we have to do it in
             // smaller chunks instead of all at once
-            for (uint8_t k = 0; k < length * 2; k += min(length * 2, I2CDEVLIB_WIRE_BUFFER_LENGTH)) {
+            for (uint16_t k = 0; k < length * 2; k += I2CDEVLIB_WORD_CHUNK) {
                 useWire->beginTransmission(devAddr);
                 useWire->write(regAddr);
                 useWire->endTransmission();
                 useWire->beginTransmission(devAddr);
-                useWire->requestFrom(devAddr, (uint8_t)(length * 2)); // length=words, this wants bytes
+                useWire->requestFrom(devAddr, (uint8_t)min((int)length * 2 - k, I2CDEVLIB_WORD_CHUNK)); // length=words, this wants bytes
     
                 bool msb = true; // starts with MSB, then LSB
                 for (; useWire->available() && count < length && (timeout == 0 || millis() - t1 < timeout);) {
@@ -418,12 +497,12 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
             // I2C/TWI subsystem uses internal buffer that breaks with large data requests
             // so if user requests more than I2CDEVLIB_WIRE_BUFFER_LENGTH bytes, we have to do it in
             // smaller chunks instead of all at once
-            for (uint8_t k = 0; k < length * 2; k += min(length * 2, I2CDEVLIB_WIRE_BUFFER_LENGTH)) {
+            for (uint16_t k = 0; k < length * 2; k += I2CDEVLIB_WORD_CHUNK) {
                 useWire->beginTransmission(devAddr);
                 useWire->write(regAddr);
                 useWire->endTransmission();
                 useWire->beginTransmission(devAddr);
-                useWire->requestFrom(devAddr, (uint8_t)(length * 2)); // length=words, this wants bytes
+                useWire->requestFrom(devAddr, (uint8_t)min((int)length * 2 - k, I2CDEVLIB_WORD_CHUNK)); // length=words, this wants bytes
         
                 bool msb = true; // starts with MSB, then LSB
                 for (; useWire->available() && count < length && (timeout == 0 || millis() - t1 < timeout);) {
@@ -470,10 +549,111 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
         Serial.print(count, DEC);
         Serial.println(" read).");
     #endif
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        endDevice(device, count > 0 ? count * 2 : 0, t0);
+    #endif
     
     return count;
 }
 
+/** Read a run of bytes from a single data port register.
+ * For registers that do not advance the device's register pointer when read,
+ * such as the MPU6050 FIFO_R_W and MEM_R_W ports, so the whole run comes from
+ * one address phase. Unlike readBytes() the length is not limited to 255 and
+ * the register address is only sent once: with Wire on Arduino 1.0.1+ the
+ * bus is held with repeated starts between I2CDEVLIB_WIRE_BUFFER_LENGTH
+ * sized reads, older Wire versions read the following chunks without
+ * re-addressing, and Fastwire re-addresses every 255 bytes.
+ * @param devAddr I2C slave device address
+ * @param regAddr Data port register to read from
+ * @param length Number of bytes to read (at most 32767, so the count fits the return value)
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure or a length above 32767)
+ */
+int16_t I2Cdev::readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout, void *wireObj) {
+    if (length > 32767) return -1;
+
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print("I2C (0x");
+        Serial.print(devAddr, HEX);
+        Serial.print(") streaming ");
+        Serial.print(length, DEC);
+        Serial.print(" bytes from 0x");
+        Serial.print(regAddr, HEX);
+        Serial.print("...");
+    #endif
+
+    int16_t count = 0;
+    uint32_t t1 = millis();
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        I2CdevDeviceClock *device = beginDevice(devAddr, wireObj);
+        uint32_t t0 = device ? micros() : 0;
+    #endif
+
+    #if (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE)
+        TwoWire *useWire = &Wire;
+        if (wireObj) useWire = (TwoWire *)wireObj;
+
+        useWire->beginTransmission(devAddr);
+        #if (ARDUINO < 100)
+            useWire->send(regAddr);
+        #else
+            useWire->write(regAddr);
+        #endif
+        #if (ARDUINO > 100 && I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE)
+            useWire->endTransmission(false);
+        #else
+            useWire->endTransmission();
+        #endif
+
+        while (count < length && (timeout == 0 || millis() - t1 < timeout)) {
+            uint8_t chunk = min((int)(length - count), I2CDEVLIB_WIRE_BUFFER_LENGTH);
+            #if (ARDUINO > 100 && I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE)
+                // no stop until the last chunk, the next request is a repeated start
+                if (useWire->requestFrom(devAddr, chunk, (uint8_t)(count + chunk >= length)) != chunk) break;
+            #else
+                if (useWire->requestFrom(devAddr, chunk) != chunk) break;
+            #endif
+            for (; useWire->available() && (timeout == 0 || millis() - t1 < timeout); count++) {
+                #if (ARDUINO < 100)
+                    data[count] = useWire->receive();
+                #else
+                    data[count] = useWire->read();
+                #endif
+            }
+        }
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
+
+        // Fastwire library
+        // readBuf() takes a byte count, so re-address every 255 bytes
+        while (count < length) {
+            uint8_t chunk = length - count > 255 ? 255 : length - count;
+            if (Fastwire::readBuf(devAddr << 1, regAddr, data + count, chunk) != 0) {
+                count = -1; // error
+                break;
+            }
+            count += chunk;
+        }
+
+    #endif
+
+    // check for timeout
+    if (timeout > 0 && millis() - t1 >= timeout && count < (int16_t)length) count = -1; // timeout
+
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print(". Done (");
+        Serial.print(count, DEC);
+        Serial.println(" read).");
+    #endif
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        endDevice(device, count > 0 ? count : 0, t0);
+    #endif
+
+    return count;
+}
+
 /** write a single bit in an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to write to
@@ -531,6 +711,25 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
     }
 }
 
+/** Write the bits selected by a mask in an 8-bit device register.
+ * Same read-modify-write as writeBits(), but the caller supplies the mask and
+ * the value already shifted into place, so nothing is computed at run time
+ * when both are constants (see I2CdevRegisterField).
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param mask Bits to change
+ * @param data New value of the masked bits, in place (other bits are ignored)
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data, void *wireObj) {
+    uint8_t b;
+    if (readByte(devAddr, regAddr, &b, I2Cdev::readTimeout, wireObj) != 0) {
+        return writeByte(devAddr, regAddr, (b & ~mask) | (data & mask), wireObj);
+    } else {
+        return false;
+    }
+}
+
 /** Write multiple bits in a 16-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to write to
@@ -598,6 +797,10 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
         Serial.print("...");
     #endif
     uint8_t status = 0;
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        I2CdevDeviceClock *device = beginDevice(devAddr, wireObj);
+        uint32_t t0 = device ? micros() : 0;
+    #endif
 
 #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE
     TwoWire *useWire = &Wire;
@@ -644,6 +847,9 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
     #ifdef I2CDEV_SERIAL_DEBUG
         Serial.println(". Done.");
     #endif
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        endDevice(device, status == 0 ? length : 0, t0);
+    #endif
     return status == 0;
 }
 
@@ -665,6 +871,10 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
         Serial.print("...");
     #endif
     uint8_t status = 0;
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        I2CdevDeviceClock *device = beginDevice(devAddr, wireObj);
+        uint32_t t0 = device ? micros() : 0;
+    #endif
 
 #if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE
     TwoWire *useWire = &Wire;
@@ -715,6 +925,9 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
     #ifdef I2CDEV_SERIAL_DEBUG
         Serial.println(". Done.");
     #endif
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        endDevice(device, status == 0 ? length * 2 : 0, t0);
+    #endif
     return status == 0;
 }
 
@@ -723,6 +936,116 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
  */
 uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
 
+/** Set the fastest bus clock a device supports.
+ * Once the bus clock is known (see setBusClock()), I2Cdev lowers the bus to
+ * this clock for the device's transactions and restores the bus clock for
+ * everyone else, so slow sensors do not hold back fast ones on the same bus.
+ * A limit above the bus clock is never applied. Registered devices also get
+ * their traffic counted, see getDeviceStats(). Until setBusClock() is called
+ * the clock set with Wire.setClock() is left alone. Strictly, standard-mode (100 kHz) devices are only specified
+ * on buses that never run faster; most tolerate fast-mode traffic to others.
+ * @param devAddr I2C slave device address
+ * @param clockHz Maximum clock in Hz (0 to remove the device's entry)
+ * @param wireObj Bus the device is on (0 for the default)
+ * @return True if the entry was stored, false if the table is full
+ *         (I2CDEV_DEVICE_CLOCKS entries)
+ */
+bool I2Cdev::setDeviceClock(uint8_t devAddr, uint32_t clockHz, void *wireObj) {
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        I2CdevDeviceClock *d = findDevice(devAddr, wireObj);
+        if (!clockHz) {
+            if (d) {
+                d -> clockHz = 0;
+                deviceClockCount--;
+            }
+            return true;
+        }
+        if (!d) {
+            for (uint8_t i = 0; !d && i < I2CDEV_DEVICE_CLOCKS; i++) {
+                if (!deviceClocks[i].clockHz) d = &deviceClocks[i];
+            }
+            if (!d) return false;
+            d -> devAddr = devAddr;
+            d -> wireObj = wireObj;
+            deviceClockCount++;
+        }
+        d -> clockHz = clockHz;
+        memset(&d -> stats, 0, sizeof(d -> stats));
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+/** Get the clock used for a device's transactions.
+ * @param devAddr I2C slave device address
+ * @param wireObj Bus the device is on (0 for the default)
+ * @return Bus clock in Hz, or the device's limit from setDeviceClock() if that
+ *         is lower; 0 if I2Cdev leaves the clock alone (no setBusClock() yet)
+ */
+uint32_t I2Cdev::getDeviceClock(uint8_t devAddr, void *wireObj) {
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        return deviceClock(findDevice(devAddr, wireObj));
+    #else
+        return 0;
+    #endif
+}
+
+/** Set the bus clock and switch the bus to it. Use this instead of
+ * Wire.setClock() to have registered devices slowed down to their limits,
+ * since I2Cdev needs to know which clock to restore after talking to them.
+ * @param clockHz Clock in Hz (0 to leave the clock to the sketch again)
+ * @param wireObj Bus to switch now (0 for the default)
+ */
+void I2Cdev::setBusClock(uint32_t clockHz, void *wireObj) {
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        baseClock = clockHz;
+        currentClock = 0;
+        if (clockHz) applyClock(clockHz, wireObj);
+    #elif I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO >= 157
+        ((TwoWire *)(wireObj ? wireObj : &Wire)) -> setClock(clockHz);
+    #elif I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
+        Fastwire::setClock(clockHz);
+    #endif
+}
+
+/** Get a registered device's traffic since setDeviceClock() or resetDeviceStats().
+ * @param devAddr I2C slave device address
+ * @param stats Receives a copy of the counters
+ * @param wireObj Bus the device is on (0 for the default)
+ * @return False if the device has no setDeviceClock() entry
+ */
+bool I2Cdev::getDeviceStats(uint8_t devAddr, I2CdevDeviceStats *stats, void *wireObj) {
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        I2CdevDeviceClock *d = findDevice(devAddr, wireObj);
+        if (!d) return false;
+        *stats = d -> stats;
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+/** Get the data rate a registered device achieved while it had the bus.
+ * @param devAddr I2C slave device address
+ * @param wireObj Bus the device is on (0 for the default)
+ * @return Bytes per second of transaction time (0 if unknown)
+ */
+uint32_t I2Cdev::getDeviceThroughput(uint8_t devAddr, void *wireObj) {
+    I2CdevDeviceStats stats;
+    if (!getDeviceStats(devAddr, &stats, wireObj) || !stats.micros) return 0;
+    return (uint32_t)((float)stats.bytes * 1000000.0f / stats.micros);
+}
+
+/** Clear the traffic counters of every registered device. */
+void I2Cdev::resetDeviceStats() {
+    #if I2CDEV_DEVICE_CLOCKS > 0
+        for (uint8_t i = 0; i < I2CDEV_DEVICE_CLOCKS; i++) {
+            memset(&deviceClocks[i].stats, 0, sizeof(deviceClocks[i].stats));
+        }
+    #endif
+}
+
 #if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE
     // I2C library
     //////////////////////
@@ -771,6 +1094,11 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         TWCR = 1 << TWEN; // enable twi module, no interrupt
     }
 
+    // change the I2C clock rate without touching the pull-ups or resetting the TWI module
+    void Fastwire::setClock(uint32_t clockHz) {
+        TWBR = F_CPU / 2 / clockHz - 8;
+    }
+
     // added by Jeff Rowberg 2013-05-07:
     // Arduino Wire-style "beginTransmission" function
     // (takes 7-bit device address like the Wire method, NOT 8-bit: 0x68, not 0xD0/0xD1)
@@ -3,6 +3,10 @@
 // 2013-06-05 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-19 - add readStream() for long reads from data port registers, fix readWords() chunking
+//      2026-10-19 - compile the device clock table out by default on AVR
+//      2026-10-19 - add per-device bus clock table with clock switching and traffic statistics
+//      2026-10-19 - add writeMasked() for precomputed field masks (see I2CdevRegister.h)
 //      2021-09-28 - allow custom Wire object as transaction function argument
 //      2020-01-20 - hardija : complete support for Teensy 3.x
 //      2015-10-30 - simondlevy : support i2c_t3 for Teensy3.1
@@ -129,6 +133,25 @@ THE SOFTWARE.
 // 1000ms default read timeout (modify with "I2Cdev::readTimeout = [ms];")
 #define I2CDEV_DEFAULT_READ_TIMEOUT     1000
 
+// number of devices that can be registered with I2Cdev::setDeviceClock(), about
+// 20 bytes of RAM each; 0 compiles clock switching and statistics out, which is
+// the default on AVR where device drivers registering in initialize() would
+// otherwise cost SRAM and a table lookup per transfer
+#ifndef I2CDEV_DEVICE_CLOCKS
+    #if defined(__AVR__)
+        #define I2CDEV_DEVICE_CLOCKS    0
+    #else
+        #define I2CDEV_DEVICE_CLOCKS    4
+    #endif
+#endif
+
+/** Traffic of one device registered with I2Cdev::setDeviceClock(). */
+struct I2CdevDeviceStats {
+    uint32_t transactions;
+    uint32_t bytes;         // data bytes, without addresses
+    uint32_t micros;        // time spent in the device's transactions
+};
+
 class I2Cdev {
     public:
         I2Cdev();
@@ -141,16 +164,25 @@ class I2Cdev {
         static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
         static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
         static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
+        static int16_t readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
 
         static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data, void *wireObj=0);
         static bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data, void *wireObj=0);
         static bool writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data, void *wireObj=0);
         static bool writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data, void *wireObj=0);
+        static bool writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data, void *wireObj=0);
         static bool writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data, void *wireObj=0);
         static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data, void *wireObj=0);
         static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj=0);
         static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj=0);
 
+        static bool setDeviceClock(uint8_t devAddr, uint32_t clockHz, void *wireObj=0);
+        static uint32_t getDeviceClock(uint8_t devAddr, void *wireObj=0);
+        static void setBusClock(uint32_t clockHz, void *wireObj=0);
+        static bool getDeviceStats(uint8_t devAddr, I2CdevDeviceStats *stats, void *wireObj=0);
+        static uint32_t getDeviceThroughput(uint8_t devAddr, void *wireObj=0);
+        static void resetDeviceStats();
+
         static uint16_t readTimeout;
 };
 
@@ -189,6 +221,7 @@ class I2Cdev {
 
         public:
             static void setup(int khz, boolean pullup);
+            static void setClock(uint32_t clockHz);
             static byte beginTransmission(byte device);
             static byte write(byte value);
             static byte writeBuf(byte device, byte address, byte *data, byte num);
@@ -0,0 +1,105 @@
+// I2Cdev library collection - declarative register configuration tables
+// Device init profiles applied with merged burst writes and status polling
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "I2CdevConfig.h"
+#include <stddef.h>
+
+/** Run a configuration table.
+ * WRITE steps to consecutive registers (reg, reg + 1, ...) are sent as one
+ * multi-byte write of up to I2CDEV_CONFIG_MAX_BURST bytes, so list registers
+ * in address order where the device allows it. MODIFY costs a read and a
+ * write, so prefer WRITE for registers whose whole content is known. POLL
+ * replaces a fixed worst-case delay: it returns as soon as the device
+ * reports the condition, and fails if it does not within the given time.
+ * @param devAddr I2C slave device address
+ * @param steps Table in PROGMEM, ended by I2CDEV_CONFIG_END
+ * @param autoIncrement Bits to OR into the register address of multi-byte
+ *        writes, for devices that need it (0x80 for most ST sensors)
+ * @return 0 on success, otherwise the 1-based index of the step that failed
+ */
+uint8_t I2CdevConfig::apply(uint8_t devAddr, const I2CdevConfigStep *steps, void *wireObj, uint8_t autoIncrement) {
+    uint8_t burst[I2CDEV_CONFIG_MAX_BURST];
+    uint8_t burstReg = 0, burstLength = 0, burstStep = 0;
+
+    for (uint8_t i = 0; ; i++) {
+        const uint8_t *p = (const uint8_t *)&steps[i];
+        uint8_t op = pgm_read_byte(p + offsetof(I2CdevConfigStep, op));
+        uint8_t reg = pgm_read_byte(p + offsetof(I2CdevConfigStep, reg));
+        uint8_t mask = pgm_read_byte(p + offsetof(I2CdevConfigStep, mask));
+        uint8_t value = pgm_read_byte(p + offsetof(I2CdevConfigStep, value));
+        uint8_t ms = pgm_read_byte(p + offsetof(I2CdevConfigStep, ms));
+
+        if (op == I2CDEV_CONFIG_OP_WRITE && burstLength > 0 && burstLength < I2CDEV_CONFIG_MAX_BURST
+                && reg == (uint8_t)(burstReg + burstLength)) {
+            burst[burstLength++] = value;
+            continue;
+        }
+
+        // anything else ends the pending burst
+        if (burstLength > 0) {
+            uint8_t address = burstLength > 1 ? burstReg | autoIncrement : burstReg;
+            if (!I2Cdev::writeBytes(devAddr, address, burstLength, burst, wireObj)) return burstStep + 1;
+            burstLength = 0;
+        }
+
+        switch (op) {
+            case I2CDEV_CONFIG_OP_END:
+                return 0;
+            case I2CDEV_CONFIG_OP_WRITE:
+                burstReg = reg;
+                burst[0] = value;
+                burstLength = 1;
+                burstStep = i;
+                break;
+            case I2CDEV_CONFIG_OP_MODIFY: {
+                uint8_t b;
+                if (I2Cdev::readByte(devAddr, reg, &b, I2Cdev::readTimeout, wireObj) <= 0) return i + 1;
+                if (!I2Cdev::writeByte(devAddr, reg, (b & ~mask) | (value & mask), wireObj)) return i + 1;
+                break;
+            }
+            case I2CDEV_CONFIG_OP_DELAY:
+                delay(ms);
+                break;
+            case I2CDEV_CONFIG_OP_POLL: {
+                uint32_t start = millis();
+                for (;;) {
+                    uint8_t b;
+                    // a device busy with a reset may not answer, keep trying until the timeout
+                    if (I2Cdev::readByte(devAddr, reg, &b, I2Cdev::readTimeout, wireObj) > 0 && (b & mask) == value) break;
+                    if (millis() - start >= ms) return i + 1;
+                    delay(1);
+                }
+                break;
+            }
+            default:
+                return i + 1;
+        }
+    }
+}
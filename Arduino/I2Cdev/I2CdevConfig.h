@@ -0,0 +1,93 @@
+// I2Cdev library collection - declarative register configuration tables header file
+// Device init profiles applied with merged burst writes and status polling
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+//     2026-10-19 - build outside Arduino with the platform port's I2Cdev.h and I2CdevPort.h
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEVCONFIG_H_
+#define _I2CDEVCONFIG_H_
+
+#ifdef ARDUINO
+    #include "I2Cdev.h"
+#else
+    #include <I2Cdev.h> // the platform port's, not the Arduino one next to this file
+    #include "I2CdevPort.h" // delay(), millis()
+#endif
+
+#ifdef __AVR__
+    #include <avr/pgmspace.h>
+#elif defined(ESP32) || defined(ESP8266)
+    #include <pgmspace.h>
+#else
+    #ifndef PROGMEM
+        #define PROGMEM
+    #endif
+    #ifndef pgm_read_byte
+        #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+    #endif
+#endif
+
+#define I2CDEV_CONFIG_OP_END        0
+#define I2CDEV_CONFIG_OP_WRITE      1   // register = value
+#define I2CDEV_CONFIG_OP_MODIFY     2   // register = (register & ~mask) | (value & mask)
+#define I2CDEV_CONFIG_OP_DELAY      3   // wait ms milliseconds
+#define I2CDEV_CONFIG_OP_POLL       4   // wait up to ms milliseconds for (register & mask) == value
+
+#define I2CDEV_CONFIG_MAX_BURST     16  // longest merged write, in data bytes
+
+/** One step of a configuration table. Build tables with the macros below,
+ * end them with I2CDEV_CONFIG_END and keep them in PROGMEM, e.g.
+ *
+ *   static const I2CdevConfigStep init[] PROGMEM = {
+ *       I2CDEV_CONFIG_WRITE(0x6B, 0x80),           // reset
+ *       I2CDEV_CONFIG_POLL(0x6B, 0x80, 0x00, 100),  // until the reset bit clears
+ *       I2CDEV_CONFIG_WRITE(0x19, 0x04),
+ *       I2CDEV_CONFIG_WRITE(0x1A, 0x03),           // sent with 0x19 as one write
+ *       I2CDEV_CONFIG_END
+ *   };
+ */
+struct I2CdevConfigStep {
+    uint8_t op;
+    uint8_t reg;
+    uint8_t mask;
+    uint8_t value;
+    uint8_t ms;
+};
+
+#define I2CDEV_CONFIG_WRITE(reg, value)             { I2CDEV_CONFIG_OP_WRITE, (reg), 0xFF, (value), 0 }
+#define I2CDEV_CONFIG_MODIFY(reg, mask, value)      { I2CDEV_CONFIG_OP_MODIFY, (reg), (mask), (value), 0 }
+#define I2CDEV_CONFIG_DELAY(ms)                     { I2CDEV_CONFIG_OP_DELAY, 0, 0, 0, (ms) }
+#define I2CDEV_CONFIG_POLL(reg, mask, value, ms)    { I2CDEV_CONFIG_OP_POLL, (reg), (mask), (value), (ms) }
+#define I2CDEV_CONFIG_END                           { I2CDEV_CONFIG_OP_END, 0, 0, 0, 0 }
+
+class I2CdevConfig {
+    public:
+        static uint8_t apply(uint8_t devAddr, const I2CdevConfigStep *steps, void *wireObj=0, uint8_t autoIncrement=0);
+};
+
+#endif /* _I2CDEVCONFIG_H_ */
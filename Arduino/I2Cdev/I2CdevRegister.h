@@ -0,0 +1,145 @@
+// I2Cdev library collection - compile-time register field descriptors
+// Bit field read/modify/write with masks and shifts resolved by the compiler
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+//     2026-10-19 - take I2Cdev.h from the include path outside Arduino builds
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEVREGISTER_H_
+#define _I2CDEVREGISTER_H_
+
+#ifdef ARDUINO
+    #include "I2Cdev.h"
+#else
+    #include <I2Cdev.h> // the platform port's, not the Arduino one next to this file
+#endif
+
+/** Value of a masked 1-bit field: the masked bits as they are, except for
+ * bool, which must hold exactly 0 or 1.
+ */
+template <typename T>
+struct I2CdevRegisterFlag {
+    static T from(uint8_t masked) { return (T)masked; }
+};
+template <>
+struct I2CdevRegisterFlag<bool> {
+    static bool from(uint8_t masked) { return masked != 0; }
+};
+
+/** One bit field of an 8-bit device register.
+ * Start and Len follow the readBits()/writeBits() convention (Start is the
+ * field's most significant bit), so the existing *_BIT and *_LENGTH defines
+ * can be used as they are:
+ *
+ *   typedef I2CdevRegisterField<MPU6050_RA_GYRO_CONFIG,
+ *       MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH> GyroRange;
+ *   GyroRange::write(devAddr, MPU6050_GYRO_FS_2000);
+ *
+ * Mask and shift are constants, so a write is one call to
+ * I2Cdev::writeMasked() with everything precomputed (a single readByte()
+ * when reading) instead of the shift loops readBits()/writeBits() need on
+ * small cores. T is the value type, e.g. an enum or bool.
+ */
+template <uint8_t Reg, uint8_t Start, uint8_t Len = 1, typename T = uint8_t>
+struct I2CdevRegisterField {
+    typedef T Type;
+    static const uint8_t reg = Reg;
+    static const uint8_t shift = Start + 1 - Len;
+    static const uint8_t mask = (uint8_t)(((1 << Len) - 1) << shift);
+
+    /** Position a value in the register. A 1-bit field is set by any
+     * non-zero value, like I2Cdev::writeBit().
+     */
+    static uint8_t encode(T value) {
+        return Len == 1 ? ((uint8_t)value ? mask : 0) : (uint8_t)(((uint8_t)value << shift) & mask);
+    }
+
+    /** Extract the field from a register value. A 1-bit field is not
+     * shifted down, it reads as non-zero when set, like I2Cdev::readBit();
+     * as a bool it reads as true.
+     */
+    static T decode(uint8_t regValue) {
+        return Len == 1 ? I2CdevRegisterFlag<T>::from(regValue & mask) : (T)((regValue & mask) >> shift);
+    }
+
+    /** Read the field. The register is read straight into *data, so a
+     * getter that keeps its buffer in the object needs no stack frame.
+     * @return Status of read operation, as I2Cdev::readBits()
+     */
+    static int8_t read(uint8_t devAddr, T *data, uint32_t timeout=I2Cdev::readTimeout, void *wireObj=0) {
+        static_assert(sizeof(T) == 1, "register fields are read in place");
+        int8_t count = I2Cdev::readByte(devAddr, Reg, (uint8_t *)data, timeout, wireObj);
+        if (count > 0) *data = decode(*(uint8_t *)data);
+        return count;
+    }
+
+    /** Write the field, leaving the register's other bits as they are.
+     * @return Status of operation (true = success)
+     */
+    static bool write(uint8_t devAddr, T value, void *wireObj=0) {
+        if (mask == 0xFF) return I2Cdev::writeByte(devAddr, Reg, encode(value), wireObj);
+        return I2Cdev::writeMasked(devAddr, Reg, mask, encode(value), wireObj);
+    }
+};
+
+/** Several fields of one register changed with a single read-modify-write.
+ *
+ *   I2CdevRegisterUpdate<MPU6050_RA_CONFIG>()
+ *       .set<ExtSync>(MPU6050_EXT_SYNC_TEMP_OUT_L)
+ *       .set<DLPFMode>(MPU6050_DLPF_BW_42)
+ *       .write(devAddr);
+ *
+ * If the fields cover the whole register the read is skipped.
+ */
+template <uint8_t Reg>
+class I2CdevRegisterUpdate {
+    public:
+        I2CdevRegisterUpdate() : mask(0), value(0) { }
+
+        /** Queue a new value for one field of this register. */
+        template <typename Field>
+        I2CdevRegisterUpdate &set(typename Field::Type fieldValue) {
+            static_assert(Field::reg == Reg, "field belongs to another register");
+            mask |= Field::mask;
+            value = (value & ~Field::mask) | Field::encode(fieldValue);
+            return *this;
+        }
+
+        /** Write all queued fields.
+         * @return Status of operation (true = success)
+         */
+        bool write(uint8_t devAddr, void *wireObj=0) {
+            if (mask == 0xFF) return I2Cdev::writeByte(devAddr, Reg, value, wireObj);
+            return I2Cdev::writeMasked(devAddr, Reg, mask, value, wireObj);
+        }
+
+    private:
+        uint8_t mask;
+        uint8_t value;
+};
+
+#endif /* _I2CDEVREGISTER_H_ */
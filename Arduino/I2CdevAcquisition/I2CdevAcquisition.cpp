@@ -0,0 +1,234 @@
+// I2Cdev library collection - multi-device acquisition scheduler
+// Interleaves periodic sampling of several I2C sensors on one bus
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "I2CdevAcquisition.h"
+
+#ifdef ARDUINO
+    #if ARDUINO < 100
+        #include "WProgram.h"
+    #else
+        #include "Arduino.h"
+    #endif
+
+static uint32_t defaultClock() {
+    return micros();
+}
+#else
+#include <time.h>
+
+static uint32_t defaultClock() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000);
+}
+#endif
+
+/** Constructor.
+ * @param clock Microsecond time source; micros() on Arduino and
+ *        CLOCK_MONOTONIC elsewhere if not given (pass a simulated clock for
+ *        host-side testing)
+ */
+I2CdevAcquisition::I2CdevAcquisition(I2CdevAcquisitionClock clock) {
+    this -> clock = clock ? clock : defaultClock;
+    taskCount = 0;
+    statsStart = 0;
+}
+
+/** Add a periodic sensor task.
+ * Priorities follow the period: the shorter the period, the more urgent the
+ * task. Tasks should be added before start().
+ * @param name Label for reports (not copied)
+ * @param periodUs Sample period in microseconds
+ * @param step Sampling sequence, see I2CdevAcquisitionStep
+ * @param arg Passed to step, e.g. the driver object
+ * @return Task id for getStats(), or -1 if I2CDEV_ACQ_MAX_TASKS are in use
+ */
+int8_t I2CdevAcquisition::addTask(const char *name, uint32_t periodUs, I2CdevAcquisitionStep step, void *arg) {
+    if (taskCount == I2CDEV_ACQ_MAX_TASKS) return -1;
+    Task *t = &tasks[taskCount];
+    t -> name = name;
+    t -> periodUs = periodUs;
+    t -> step = step;
+    t -> arg = arg;
+    t -> phase = 0;
+    t -> active = false;
+
+    // insertion sort into priority order, equal periods keep addTask() order
+    uint8_t i = taskCount;
+    while (i > 0 && tasks[order[i - 1]].periodUs > periodUs) {
+        order[i] = order[i - 1];
+        i--;
+    }
+    order[i] = taskCount;
+    return taskCount++;
+}
+
+/** Release every task now and clear the statistics. */
+void I2CdevAcquisition::start() {
+    uint32_t now = clock();
+    for (uint8_t i = 0; i < taskCount; i++) {
+        tasks[i].release = now;
+        tasks[i].phase = 0;
+        tasks[i].active = false;
+    }
+    resetStats();
+}
+
+/** Run the most urgent step that is due, if any.
+ * @return 0 if a step was run (call again), otherwise the number of
+ *         microseconds until the next step is due
+ */
+uint32_t I2CdevAcquisition::poll() {
+    uint32_t now = clock();
+    uint32_t wait;
+    int8_t id = nextReady(now, &wait);
+    if (id < 0) return wait;
+
+    Task *t = &tasks[id];
+    if (!t -> active) {
+        t -> active = true;
+        t -> phase = 0;
+    }
+    int32_t delayUs = t -> step(t -> arg, t -> phase);
+    uint32_t end = clock();
+
+    uint32_t used = end - now;
+    t -> stats.busUs += used;
+    if (used > t -> stats.maxStepUs) t -> stats.maxStepUs = used;
+    if (delayUs == I2CDEV_ACQ_DONE) {
+        complete(t, end);
+    } else {
+        t -> phase++;
+        t -> due = end + (delayUs > 0 ? delayUs : 0);
+    }
+    return 0;
+}
+
+/** Get the number of tasks added so far.
+ * @return Task count
+ */
+uint8_t I2CdevAcquisition::getTaskCount() {
+    return taskCount;
+}
+
+/** Get a task's label.
+ * @param task Task id as returned by addTask()
+ * @return Name given to addTask()
+ */
+const char *I2CdevAcquisition::getTaskName(uint8_t task) {
+    return tasks[task].name;
+}
+
+/** Get a task's counters.
+ * @param task Task id as returned by addTask()
+ * @param stats Receives a copy of the counters
+ */
+void I2CdevAcquisition::getStats(uint8_t task, I2CdevAcquisitionStats *stats) {
+    *stats = tasks[task].stats;
+}
+
+/** Get the share of time spent in step() calls since start() or resetStats().
+ * @return Bus utilisation in tenths of a percent (0-1000)
+ */
+uint16_t I2CdevAcquisition::getBusUtilization() {
+    uint32_t elapsed = clock() - statsStart;
+    if (elapsed == 0) return 0;
+    uint64_t busy = 0;
+    for (uint8_t i = 0; i < taskCount; i++) busy += tasks[i].stats.busUs;
+    return busy * 1000 / elapsed;
+}
+
+/** Clear every task's counters and restart the utilisation window. */
+void I2CdevAcquisition::resetStats() {
+    for (uint8_t i = 0; i < taskCount; i++) {
+        I2CdevAcquisitionStats *s = &tasks[i].stats;
+        s -> samples = 0;
+        s -> overruns = 0;
+        s -> maxLatencyUs = 0;
+        s -> sumLatencyUs = 0;
+        s -> maxStepUs = 0;
+        s -> busUs = 0;
+    }
+    statsStart = clock();
+}
+
+/** Pick the step to run next.
+ * Walks the tasks in priority order. A due step runs unless it could make a
+ * more urgent task miss the end of its period: each more urgent task leaves
+ * as slack the time until its period ends minus its longest step so far (but
+ * never less than the time until it is due), and a step only runs if its own
+ * longest duration fits in the smallest slack. Otherwise lower priority steps
+ * that fit are tried instead.
+ * @param now Current time
+ * @param wait Receives the time until the earliest step that is not yet due
+ * @return Task id to run, or -1 if nothing can run now
+ */
+int8_t I2CdevAcquisition::nextReady(uint32_t now, uint32_t *wait) {
+    uint32_t horizon = 0xFFFFFFFF; // time a step may take without delaying a more urgent task too long
+    uint32_t earliest = 0xFFFFFFFF;
+    for (uint8_t i = 0; i < taskCount; i++) {
+        Task *t = &tasks[order[i]];
+        int32_t until = (int32_t)((t -> active ? t -> due : t -> release) - now);
+        if (until <= 0) {
+            if (t -> stats.maxStepUs <= horizon) return order[i];
+            until = 0;
+        } else if ((uint32_t)until < earliest) {
+            earliest = until;
+        }
+        int32_t slack = (int32_t)(t -> release + t -> periodUs - now - t -> stats.maxStepUs);
+        if (slack < until) slack = until;
+        if ((uint32_t)slack < horizon) horizon = slack;
+    }
+    *wait = earliest;
+    return -1;
+}
+
+/** Account for a finished sample and schedule the task's next release.
+ * A sample that ends after its next release time is followed immediately by
+ * the next one; if it ran past more than a whole period, the missed releases
+ * are skipped and counted as overruns.
+ * @param task Task whose last step returned I2CDEV_ACQ_DONE
+ * @param now Time the step ended
+ */
+void I2CdevAcquisition::complete(Task *task, uint32_t now) {
+    I2CdevAcquisitionStats *s = &task -> stats;
+    uint32_t latency = now - task -> release;
+    s -> samples++;
+    s -> sumLatencyUs += latency;
+    if (latency > s -> maxLatencyUs) s -> maxLatencyUs = latency;
+
+    task -> active = false;
+    task -> phase = 0;
+    task -> release += task -> periodUs;
+    while ((int32_t)(now - task -> release) >= (int32_t)task -> periodUs) {
+        task -> release += task -> periodUs;
+        s -> overruns++;
+    }
+}
@@ -0,0 +1,112 @@
+// I2Cdev library collection - multi-device acquisition scheduler header file
+// Interleaves periodic sampling of several I2C sensors on one bus
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEVACQUISITION_H_
+#define _I2CDEVACQUISITION_H_
+
+#include <stdint.h>
+
+#define I2CDEV_ACQ_MAX_TASKS    8
+#define I2CDEV_ACQ_DONE         -1  // step() return value: the sample is complete
+
+/** One step of a sensor's sampling sequence. Called with phase 0 at every
+ * release of the task, then with phase 1, 2, ... for as long as it returns
+ * a delay. A step does the bus work for that phase only (trigger a
+ * conversion, or read a result and maybe trigger the next one) and returns
+ * how many microseconds the sensor needs before the next phase can run, or
+ * I2CDEV_ACQ_DONE once the sample is complete. Example for a BMP085:
+ *   phase 0: start temperature, return 4500
+ *   phase 1: read temperature, start pressure, return 7500
+ *   phase 2: read pressure, return I2CDEV_ACQ_DONE
+ */
+typedef int32_t (*I2CdevAcquisitionStep)(void *arg, uint8_t phase);
+
+/** Microsecond time source; wraps at 2^32. */
+typedef uint32_t (*I2CdevAcquisitionClock)();
+
+/** Per-task counters since start() or resetStats(). Latency is measured from
+ * the task's release (the start of its period) to the end of its last step.
+ */
+struct I2CdevAcquisitionStats {
+    uint32_t samples;       // completed samples
+    uint32_t overruns;      // releases skipped because the previous sample was still running
+    uint32_t maxLatencyUs;
+    uint64_t sumLatencyUs;  // divide by samples for the mean
+    uint32_t maxStepUs;     // longest single step, used to avoid blocking more urgent tasks
+    uint64_t busUs;         // total time spent inside step()
+};
+
+/** Rate-monotonic acquisition scheduler. Tasks with shorter periods get
+ * higher priority. Call poll() from the main loop: it runs at most one
+ * ready step and returns how long the caller may do other work before the
+ * next one is due. Steps are never interrupted, but a lower priority step
+ * is held back if its longest observed duration could push a higher
+ * priority task past the end of its period, so conversion waits of one
+ * sensor are filled with bus work for the others without making the urgent
+ * ones miss a sample.
+ */
+class I2CdevAcquisition {
+    public:
+        I2CdevAcquisition(I2CdevAcquisitionClock clock=0);
+
+        int8_t addTask(const char *name, uint32_t periodUs, I2CdevAcquisitionStep step, void *arg=0);
+        void start();
+        uint32_t poll();
+
+        uint8_t getTaskCount();
+        const char *getTaskName(uint8_t task);
+        void getStats(uint8_t task, I2CdevAcquisitionStats *stats);
+        uint16_t getBusUtilization();
+        void resetStats();
+
+    private:
+        struct Task {
+            const char *name;
+            uint32_t periodUs;
+            I2CdevAcquisitionStep step;
+            void *arg;
+            uint32_t release;   // start of the current (or next) period
+            uint32_t due;       // when the next step may run
+            uint8_t phase;
+            bool active;        // a sample is in progress
+            I2CdevAcquisitionStats stats;
+        };
+
+        int8_t nextReady(uint32_t now, uint32_t *wait);
+        void complete(Task *task, uint32_t now);
+
+        I2CdevAcquisitionClock clock;
+        Task tasks[I2CDEV_ACQ_MAX_TASKS];   // in addTask() order, indices are task ids
+        uint8_t order[I2CDEV_ACQ_MAX_TASKS];  // task ids by priority (shortest period first)
+        uint8_t taskCount;
+        uint32_t statsStart;
+};
+
+#endif /* _I2CDEVACQUISITION_H_ */
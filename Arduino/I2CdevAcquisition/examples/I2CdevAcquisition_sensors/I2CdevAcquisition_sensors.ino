@@ -0,0 +1,144 @@
+// I2Cdev library collection - I2CdevAcquisition multi-sensor example
+// Samples an MPU6050 at 200 Hz, an HMC5883L at 75 Hz, a BMP085 at 25 Hz and
+// a DS1307 at 1 Hz from one bus. The BMP085 conversion waits are split into
+// separate steps, so the other sensors are read while it converts instead of
+// the loop sitting in delay(). Every 5 seconds, prints achieved rates,
+// latency and bus utilisation.
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include "Wire.h"
+
+// I2Cdev, I2CdevAcquisition and the sensor classes must be installed as
+// libraries, or else the .cpp/.h files must be in the include path of your project
+#include "I2Cdev.h"
+#include "I2CdevAcquisition.h"
+#include "MPU6050.h"
+#include "HMC5883L.h"
+#include "BMP085.h"
+#include "DS1307.h"
+
+// the DS1307 only answers on 0x68, so the MPU6050 needs AD0 pulled high
+MPU6050 accelgyro(MPU6050_ADDRESS_AD0_HIGH);
+HMC5883L mag;
+BMP085 barometer;
+DS1307 rtc;
+
+I2CdevAcquisition acquisition;
+
+int16_t ax, ay, az, gx, gy, gz;
+int16_t mx, my, mz;
+float temperature;
+int32_t pressure;
+uint16_t year;
+uint8_t month, day, hours, minutes, seconds;
+
+uint32_t lastReport;
+
+int32_t sampleIMU(void *arg, uint8_t phase) {
+    ((MPU6050 *)arg) -> getMotion6(&ax, &ay, &az, &gx, &gy, &gz);
+    return I2CDEV_ACQ_DONE;
+}
+
+int32_t sampleMag(void *arg, uint8_t phase) {
+    ((HMC5883L *)arg) -> readSample(&mx, &my, &mz);
+    return I2CDEV_ACQ_DONE;
+}
+
+int32_t sampleBaro(void *arg, uint8_t phase) {
+    BMP085 *bmp = (BMP085 *)arg;
+    switch (phase) {
+        case 0:
+            bmp -> setControl(BMP085_MODE_TEMPERATURE);
+            return bmp -> getMeasureDelayMicroseconds();
+        case 1:
+            temperature = bmp -> getTemperatureC();
+            bmp -> setControl(BMP085_MODE_PRESSURE_1);
+            return bmp -> getMeasureDelayMicroseconds();
+        default:
+            pressure = bmp -> getPressure();
+            return I2CDEV_ACQ_DONE;
+    }
+}
+
+int32_t sampleClock(void *arg, uint8_t phase) {
+    ((DS1307 *)arg) -> getDateTime24(&year, &month, &day, &hours, &minutes, &seconds);
+    return I2CDEV_ACQ_DONE;
+}
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    Wire.begin();
+    // set 400 kHz through I2Cdev rather than Wire.setClock(), so that the
+    // DS1307 is slowed down to its 100 kHz for its own reads
+    I2Cdev::setBusClock(400000);
+
+    // initialize serial communication
+    Serial.begin(38400);
+
+    // initialize devices
+    Serial.println("Initializing I2C devices...");
+    accelgyro.initialize();
+    mag.initialize();
+    mag.initializeSampler(HMC5883L_RATE_75);
+    barometer.initialize();
+    barometer.loadCalibration();
+    rtc.initialize();
+
+    // periods in microseconds; priorities follow from the periods
+    acquisition.addTask("MPU6050", 5000, sampleIMU, &accelgyro);
+    acquisition.addTask("HMC5883L", 13333, sampleMag, &mag);
+    acquisition.addTask("BMP085", 40000, sampleBaro, &barometer);
+    acquisition.addTask("DS1307", 1000000, sampleClock, &rtc);
+    acquisition.start();
+    lastReport = millis();
+}
+
+void loop() {
+    // returns 0 after running a step; otherwise there is time for other work
+    if (acquisition.poll()) {
+        if (millis() - lastReport >= 5000) {
+            for (uint8_t i = 0; i < acquisition.getTaskCount(); i++) {
+                I2CdevAcquisitionStats stats;
+                acquisition.getStats(i, &stats);
+                Serial.print(acquisition.getTaskName(i));
+                Serial.print(":\t"); Serial.print(stats.samples / 5.0);
+                Serial.print(" Hz\tlatency avg "); Serial.print(stats.samples ? (uint32_t)(stats.sumLatencyUs / stats.samples) : 0);
+                Serial.print(" max "); Serial.print(stats.maxLatencyUs);
+                Serial.print(" us\toverruns "); Serial.println(stats.overruns);
+            }
+            Serial.print("bus utilisation ");
+            Serial.print(acquisition.getBusUtilization() / 10.0);
+            Serial.println("%");
+            acquisition.resetStats();
+            lastReport = millis();
+        }
+    }
+}
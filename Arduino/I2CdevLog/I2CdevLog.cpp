@@ -0,0 +1,297 @@
+// I2Cdev library collection - binary sensor log format
+// Compact self-describing record stream for raw sensor samples, with a
+// zero-allocation writer and a reader for converting logs on the host
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "I2CdevLog.h"
+#include <string.h>
+
+/** Constructor.
+ * @param buffer Staging buffer for records; 64 bytes or more keeps sink calls rare
+ * @param size Size of buffer in bytes
+ * @param sink Called with each full buffer and on flush()
+ * @param context Passed to sink, e.g. &Serial or a FILE*
+ */
+I2CdevLogWriter::I2CdevLogWriter(uint8_t *buffer, uint16_t size, I2CdevLogSink sink, void *context) {
+    this -> buffer = buffer;
+    this -> size = size;
+    this -> sink = sink;
+    this -> context = context;
+    used = 0;
+    bytesWritten = 0;
+    timed = false;
+    memset(channels, 0, sizeof(channels));
+}
+
+/** Start a new log: write the stream header and forget all sources. */
+void I2CdevLogWriter::begin() {
+    static const uint8_t header[I2CDEV_LOG_HEADER_SIZE] = { 'I', '2', 'C', 'L', I2CDEV_LOG_VERSION, 0 };
+    put(header, sizeof(header));
+    timed = false;
+    memset(channels, 0, sizeof(channels));
+}
+
+/** Describe a device so its samples can be written and decoded.
+ * @param source Source id used in writeSample() (0 to I2CDEV_LOG_MAX_SOURCES-1)
+ * @param name Device name, truncated to 8 characters (e.g. "MPU6050")
+ * @param channels Number of int16 values per sample (1 to I2CDEV_LOG_MAX_CHANNELS)
+ * @param labels Channel names, truncated to 4 characters (e.g. "ax"), or 0
+ * @param scales Physical units per LSB for each channel (e.g. 9.80665/16384
+ *        for m/s^2 at +/-2g), or 0 for raw counts
+ * @param periodUs Nominal sample period, or 0 if irregular
+ * @return True on success, false if source or channels is out of range
+ */
+bool I2CdevLogWriter::addSource(uint8_t source, const char *name, uint8_t channels, const char * const *labels, const float *scales, uint32_t periodUs) {
+    if (source >= I2CDEV_LOG_MAX_SOURCES || channels == 0 || channels > I2CDEV_LOG_MAX_CHANNELS) return false;
+    this -> channels[source] = channels;
+
+    putByte(I2CDEV_LOG_TAG_SOURCE | source);
+    putByte(channels);
+    putUint32(periodUs);
+    putText(name, I2CDEV_LOG_NAME_LENGTH);
+    for (uint8_t i = 0; i < channels; i++) {
+        putText(labels ? labels[i] : 0, I2CDEV_LOG_LABEL_LENGTH);
+        float scale = scales ? scales[i] : 1.0f;
+        uint32_t bits;
+        memcpy(&bits, &scale, sizeof(bits));
+        putUint32(bits);
+    }
+    return true;
+}
+
+/** Write one sample.
+ * The timestamp is stored as a delta to the previous sample when it fits in
+ * 8 or 16 bits, which is the case for any sensor polled faster than 15 Hz.
+ * @param source Source id given to addSource()
+ * @param timestamp Sample time in microseconds
+ * @param data One raw value per channel
+ * @return True on success, false if the source has not been described
+ */
+bool I2CdevLogWriter::writeSample(uint8_t source, uint32_t timestamp, const int16_t *data) {
+    if (source >= I2CDEV_LOG_MAX_SOURCES || channels[source] == 0) return false;
+
+    // tag + 4-byte time + 16 channels fits in 37 bytes
+    uint8_t record[5 + I2CDEV_LOG_MAX_CHANNELS * 2];
+    uint8_t n = 0;
+    uint32_t delta = timestamp - lastTimestamp;
+    if (timed && delta <= 0xFF) {
+        record[n++] = I2CDEV_LOG_TAG_DELTA8 | source;
+        record[n++] = delta;
+    } else if (timed && delta <= 0xFFFF) {
+        record[n++] = I2CDEV_LOG_TAG_DELTA16 | source;
+        record[n++] = delta;
+        record[n++] = delta >> 8;
+    } else {
+        record[n++] = I2CDEV_LOG_TAG_ABSOLUTE | source;
+        record[n++] = timestamp;
+        record[n++] = timestamp >> 8;
+        record[n++] = timestamp >> 16;
+        record[n++] = timestamp >> 24;
+    }
+    for (uint8_t i = 0; i < channels[source]; i++) {
+        record[n++] = data[i];
+        record[n++] = (uint16_t)data[i] >> 8;
+    }
+    put(record, n);
+    lastTimestamp = timestamp;
+    timed = true;
+    return true;
+}
+
+/** Write one timestamped sample record.
+ * @param sample Record from I2CdevTimebase::stamp(); sample->source selects
+ *        the descriptor
+ * @return True on success, false if the source has not been described or
+ *         has more than the I2CDEV_SAMPLE_CHANNELS channels a record holds
+ */
+bool I2CdevLogWriter::writeSample(const I2CdevSample *sample) {
+    if (sample -> source < I2CDEV_LOG_MAX_SOURCES && channels[sample -> source] > I2CDEV_SAMPLE_CHANNELS) return false;
+    return writeSample(sample -> source, sample -> timestamp, sample -> data);
+}
+
+/** Hand everything buffered so far to the sink. */
+void I2CdevLogWriter::flush() {
+    if (used == 0) return;
+    sink(context, buffer, used);
+    used = 0;
+}
+
+/** Get the size of the log so far, including bytes not yet flushed.
+ * @return Byte count since construction
+ */
+uint32_t I2CdevLogWriter::getBytesWritten() {
+    return bytesWritten;
+}
+
+void I2CdevLogWriter::put(const uint8_t *data, uint16_t length) {
+    bytesWritten += length;
+    while (length) {
+        uint16_t chunk = size - used;
+        if (chunk > length) chunk = length;
+        memcpy(buffer + used, data, chunk);
+        used += chunk;
+        data += chunk;
+        length -= chunk;
+        if (used == size) flush();
+    }
+}
+
+void I2CdevLogWriter::putByte(uint8_t value) {
+    put(&value, 1);
+}
+
+void I2CdevLogWriter::putUint32(uint32_t value) {
+    uint8_t bytes[4] = { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24) };
+    put(bytes, 4);
+}
+
+void I2CdevLogWriter::putText(const char *text, uint8_t length) {
+    for (uint8_t i = 0; i < length; i++) {
+        putByte(text && *text ? *text++ : 0);
+    }
+}
+
+static uint32_t readUint32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/** Constructor. Call setData() before next(). */
+I2CdevLogReader::I2CdevLogReader() {
+    data = 0;
+    length = 0;
+    offset = 0;
+    headerRead = false;
+    lastTimestamp = 0;
+    lastSource = 0;
+    memset(sources, 0, sizeof(sources));
+}
+
+/** Point the reader at (more of) a log. Decoding state such as the source
+ * descriptors and the last timestamp carries over, so a log can be fed in
+ * pieces as long as each piece starts where the previous next() stopped.
+ * @param data Log bytes
+ * @param length Number of bytes
+ */
+void I2CdevLogReader::setData(const uint8_t *data, uint32_t length) {
+    this -> data = data;
+    this -> length = length;
+    offset = 0;
+}
+
+/** Decode the next record.
+ * @param sample Receives the sample when I2CDEV_LOG_SAMPLE is returned
+ * @return I2CDEV_LOG_SAMPLE, I2CDEV_LOG_DESCRIPTOR (see getLastSource()),
+ *         I2CDEV_LOG_END at the end of the data, I2CDEV_LOG_INCOMPLETE if
+ *         the data ends inside a record, or I2CDEV_LOG_ERROR on a bad header,
+ *         an unknown source or unsupported channel count
+ */
+int8_t I2CdevLogReader::next(I2CdevLogSample *sample) {
+    const uint8_t *p = data + offset;
+    uint32_t left = length - offset;
+
+    if (!headerRead) {
+        if (left < I2CDEV_LOG_HEADER_SIZE) return left ? I2CDEV_LOG_INCOMPLETE : I2CDEV_LOG_END;
+        if (memcmp(p, "I2CL", 4) != 0 || p[4] != I2CDEV_LOG_VERSION) return I2CDEV_LOG_ERROR;
+        offset += I2CDEV_LOG_HEADER_SIZE;
+        headerRead = true;
+        return next(sample);
+    }
+    if (left == 0) return I2CDEV_LOG_END;
+
+    uint8_t kind = p[0] & I2CDEV_LOG_TAG_KIND_MASK;
+    uint8_t source = p[0] & I2CDEV_LOG_TAG_SOURCE_MASK;
+    if (source >= I2CDEV_LOG_MAX_SOURCES) return I2CDEV_LOG_ERROR;
+    I2CdevLogSource *s = &sources[source];
+
+    if (kind == I2CDEV_LOG_TAG_SOURCE) {
+        if (left < 14) return I2CDEV_LOG_INCOMPLETE;
+        uint8_t channels = p[1];
+        if (channels == 0 || channels > I2CDEV_LOG_MAX_CHANNELS) return I2CDEV_LOG_ERROR;
+        uint32_t size = 14 + (uint32_t)channels * 8;
+        if (left < size) return I2CDEV_LOG_INCOMPLETE;
+        s -> channels = channels;
+        s -> periodUs = readUint32(p + 2);
+        memcpy(s -> name, p + 6, I2CDEV_LOG_NAME_LENGTH);
+        s -> name[I2CDEV_LOG_NAME_LENGTH] = 0;
+        for (uint8_t i = 0; i < channels; i++) {
+            const uint8_t *c = p + 14 + i * 8;
+            memcpy(s -> labels[i], c, I2CDEV_LOG_LABEL_LENGTH);
+            s -> labels[i][I2CDEV_LOG_LABEL_LENGTH] = 0;
+            uint32_t bits = readUint32(c + 4);
+            memcpy(&s -> scales[i], &bits, sizeof(bits));
+        }
+        lastSource = source;
+        offset += size;
+        return I2CDEV_LOG_DESCRIPTOR;
+    }
+
+    if (s -> channels == 0) return I2CDEV_LOG_ERROR;
+    uint8_t timeBytes = kind == I2CDEV_LOG_TAG_DELTA8 ? 1 : kind == I2CDEV_LOG_TAG_DELTA16 ? 2 : 4;
+    uint32_t size = 1 + timeBytes + (uint32_t)s -> channels * 2;
+    if (left < size) return I2CDEV_LOG_INCOMPLETE;
+    if (timeBytes == 1) {
+        lastTimestamp += p[1];
+    } else if (timeBytes == 2) {
+        lastTimestamp += p[1] | ((uint16_t)p[2] << 8);
+    } else {
+        lastTimestamp = readUint32(p + 1);
+    }
+    sample -> source = source;
+    sample -> timestamp = lastTimestamp;
+    const uint8_t *d = p + 1 + timeBytes;
+    for (uint8_t i = 0; i < s -> channels; i++) {
+        sample -> data[i] = (int16_t)(d[i * 2] | ((uint16_t)d[i * 2 + 1] << 8));
+    }
+    lastSource = source;
+    offset += size;
+    return I2CDEV_LOG_SAMPLE;
+}
+
+/** Get the position of the first byte not yet decoded.
+ * @return Offset into the data given to setData()
+ */
+uint32_t I2CdevLogReader::getOffset() {
+    return offset;
+}
+
+/** Get a device description.
+ * @param source Source id
+ * @return Descriptor, or 0 if none has been read for this source
+ */
+const I2CdevLogSource *I2CdevLogReader::getSource(uint8_t source) {
+    if (source >= I2CDEV_LOG_MAX_SOURCES || sources[source].channels == 0) return 0;
+    return &sources[source];
+}
+
+/** Get the source of the record last returned by next().
+ * @return Source id
+ */
+uint8_t I2CdevLogReader::getLastSource() {
+    return lastSource;
+}
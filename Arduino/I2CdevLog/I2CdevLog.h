@@ -0,0 +1,156 @@
+// I2Cdev library collection - binary sensor log format header file
+// Compact self-describing record stream for raw sensor samples, with a
+// zero-allocation writer and a reader for converting logs on the host
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEVLOG_H_
+#define _I2CDEVLOG_H_
+
+#include <stdint.h>
+#include "I2CdevTimebase.h"
+
+/* Stream layout, all multi-byte fields little endian:
+ *
+ *   header      "I2CL", version (1 byte), reserved (1 byte)
+ *   records     tag byte, then a body depending on the tag
+ *
+ * Tag bits 7-6 give the record kind, bits 5-0 the source id (0-63):
+ *   00  sample, 1-byte timestamp delta, then one int16 per channel
+ *   01  sample, 2-byte timestamp delta, then one int16 per channel
+ *   10  sample, 4-byte absolute timestamp, then one int16 per channel
+ *   11  source descriptor: channel count (1), nominal period in us (4),
+ *       device name (8, NUL padded), then per channel a label (4, NUL
+ *       padded) and the scale in physical units per LSB (IEEE-754 float)
+ *
+ * Timestamps are microseconds. A delta is relative to the previous sample
+ * record of any source, so records stay in write order when several
+ * devices share one log. A source's descriptor must come before its first
+ * sample; the channel count comes from there.
+ */
+
+#define I2CDEV_LOG_VERSION          1
+#define I2CDEV_LOG_HEADER_SIZE      6
+
+#define I2CDEV_LOG_MAX_SOURCES      16
+#define I2CDEV_LOG_MAX_CHANNELS     16
+#define I2CDEV_LOG_NAME_LENGTH      8
+#define I2CDEV_LOG_LABEL_LENGTH     4
+
+#define I2CDEV_LOG_TAG_DELTA8       0x00
+#define I2CDEV_LOG_TAG_DELTA16      0x40
+#define I2CDEV_LOG_TAG_ABSOLUTE     0x80
+#define I2CDEV_LOG_TAG_SOURCE       0xC0
+#define I2CDEV_LOG_TAG_KIND_MASK    0xC0
+#define I2CDEV_LOG_TAG_SOURCE_MASK  0x3F
+
+#define I2CDEV_LOG_SAMPLE           1   // I2CdevLogReader::next() results
+#define I2CDEV_LOG_DESCRIPTOR       2
+#define I2CDEV_LOG_END              0
+#define I2CDEV_LOG_INCOMPLETE       -1
+#define I2CDEV_LOG_ERROR            -2
+
+/** Receives bytes from I2CdevLogWriter, e.g. Serial.write() or fwrite(). */
+typedef void (*I2CdevLogSink)(void *context, const uint8_t *data, uint16_t length);
+
+/** Streaming log writer. Records are assembled in a caller-supplied buffer
+ * and handed to the sink whenever it fills up (or on flush()), so the sink
+ * sees few, large writes and nothing is allocated.
+ */
+class I2CdevLogWriter {
+    public:
+        I2CdevLogWriter(uint8_t *buffer, uint16_t size, I2CdevLogSink sink, void *context=0);
+
+        void begin();
+        bool addSource(uint8_t source, const char *name, uint8_t channels, const char * const *labels, const float *scales, uint32_t periodUs=0);
+        bool writeSample(uint8_t source, uint32_t timestamp, const int16_t *data);
+        bool writeSample(const I2CdevSample *sample);
+        void flush();
+
+        uint32_t getBytesWritten();
+
+    private:
+        void put(const uint8_t *data, uint16_t length);
+        void putByte(uint8_t value);
+        void putUint32(uint32_t value);
+        void putText(const char *text, uint8_t length);
+
+        uint8_t *buffer;
+        uint16_t size;
+        uint16_t used;
+        I2CdevLogSink sink;
+        void *context;
+        uint32_t bytesWritten;
+        uint32_t lastTimestamp;
+        bool timed;                                 // lastTimestamp is valid
+        uint8_t channels[I2CDEV_LOG_MAX_SOURCES];   // 0 for sources without a descriptor
+};
+
+/** Description of one logged device, from its descriptor record. */
+typedef struct {
+    char name[I2CDEV_LOG_NAME_LENGTH + 1];
+    uint8_t channels;
+    uint32_t periodUs;
+    char labels[I2CDEV_LOG_MAX_CHANNELS][I2CDEV_LOG_LABEL_LENGTH + 1];
+    float scales[I2CDEV_LOG_MAX_CHANNELS];
+} I2CdevLogSource;
+
+/** One decoded sample record. */
+typedef struct {
+    uint8_t source;
+    uint32_t timestamp;
+    int16_t data[I2CDEV_LOG_MAX_CHANNELS];
+} I2CdevLogSample;
+
+/** Log reader working on a memory buffer. next() decodes one record at a
+ * time; when a record runs past the end of the data it returns
+ * I2CDEV_LOG_INCOMPLETE without consuming anything, so the caller can move
+ * the unread bytes (from getOffset()) to the front, append more and call
+ * setData() again.
+ */
+class I2CdevLogReader {
+    public:
+        I2CdevLogReader();
+
+        void setData(const uint8_t *data, uint32_t length);
+        int8_t next(I2CdevLogSample *sample);
+        uint32_t getOffset();
+        const I2CdevLogSource *getSource(uint8_t source);
+        uint8_t getLastSource();
+
+    private:
+        const uint8_t *data;
+        uint32_t length;
+        uint32_t offset;
+        bool headerRead;
+        uint32_t lastTimestamp;
+        uint8_t lastSource;
+        I2CdevLogSource sources[I2CDEV_LOG_MAX_SOURCES];
+};
+
+#endif /* _I2CDEVLOG_H_ */
@@ -0,0 +1,94 @@
+// I2Cdev library collection - I2CdevLog MPU6050 + HMC5883L binary logging example
+// Same idea as MPU6050_raw, but samples go out over the serial port as a
+// binary I2CdevLog stream instead of text: about 17 bytes per accel/gyro
+// sample instead of 40-60, and no number formatting on the Arduino. Capture
+// the port to a file and convert it with extras/I2CdevLog_csv, e.g.
+//   stty -F /dev/ttyUSB0 raw 115200 && cat /dev/ttyUSB0 > log.bin
+//   ./I2CdevLog_csv log.bin > log.csv
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include "Wire.h"
+
+// I2Cdev, I2CdevLog, I2CdevTimebase, MPU6050 and HMC5883L must be installed
+// as libraries, or else the .cpp/.h files must be in the include path of your project
+#include "I2Cdev.h"
+#include "I2CdevLog.h"
+#include "MPU6050.h"
+#include "HMC5883L.h"
+
+#define SOURCE_IMU  0
+#define SOURCE_MAG  1
+
+MPU6050 accelgyro;
+HMC5883L mag;
+
+// +/-2g and +/-250 deg/s full scale, 1.3 Ga magnetometer gain
+const char * const imuLabels[6] = { "ax", "ay", "az", "gx", "gy", "gz" };
+const float imuScales[6] = { 9.80665 / 16384, 9.80665 / 16384, 9.80665 / 16384, 1.0 / 131, 1.0 / 131, 1.0 / 131 };
+const char * const magLabels[3] = { "mx", "my", "mz" };
+const float magScales[3] = { 0.092, 0.092, 0.092 }; // uT per LSB
+
+void serialSink(void *context, const uint8_t *data, uint16_t length) {
+    Serial.write(data, length);
+}
+
+uint8_t logBuffer[64];
+I2CdevLogWriter logWriter(logBuffer, sizeof(logBuffer), serialSink);
+
+int16_t imu[6];
+int16_t field[3];
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    Wire.begin();
+    Wire.setClock(400000);
+
+    // binary output needs a fast port: 1 kHz of 17-byte records is 170 kbit/s
+    Serial.begin(500000);
+
+    accelgyro.initialize();
+    accelgyro.setI2CBypassEnabled(true); // reach an HMC5883L behind the MPU6050 (GY-86/87 boards)
+    mag.initialize();
+    mag.initializeSampler(HMC5883L_RATE_75);
+
+    logWriter.begin();
+    logWriter.addSource(SOURCE_IMU, "MPU6050", 6, imuLabels, imuScales, accelgyro.getSamplePeriodMicroseconds());
+    logWriter.addSource(SOURCE_MAG, "HMC5883L", 3, magLabels, magScales, 13333);
+}
+
+void loop() {
+    accelgyro.getMotion6(&imu[0], &imu[1], &imu[2], &imu[3], &imu[4], &imu[5]);
+    logWriter.writeSample(SOURCE_IMU, micros(), imu);
+
+    if (mag.readSample(&field[0], &field[1], &field[2])) {
+        logWriter.writeSample(SOURCE_MAG, micros(), field);
+    }
+}
@@ -0,0 +1,102 @@
+/*
+I2Cdev library collection - I2CdevLog to CSV converter
+Reads a binary log written by I2CdevLogWriter (a file, or a capture of the
+serial port) and prints one CSV line per sample: timestamp in microseconds,
+device name, then each channel in physical units (or raw counts with -r).
+A comment line with the channel labels is printed whenever a device
+descriptor is read.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile on any host with a C++ compiler
+  1. then from bash
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ g++ -O2 -o I2CdevLog_csv ${PATH_I2CDEVLIB}Arduino/I2CdevLog/extras/I2CdevLog_csv.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/I2CdevLog ${PATH_I2CDEVLIB}Arduino/I2CdevLog/I2CdevLog.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/I2CdevTimebase
+      $ ./I2CdevLog_csv [-r] log.bin > log.csv
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "I2CdevLog.h"
+
+int main(int argc, char **argv) {
+  bool raw = false;
+  const char *path = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-r") == 0) raw = true;
+    else path = argv[i];
+  }
+  FILE *in = path ? fopen(path, "rb") : stdin;
+  if (!in) {
+    perror(path);
+    return 1;
+  }
+
+  static uint8_t buffer[65536];
+  uint32_t filled = 0;
+  I2CdevLogReader reader;
+  I2CdevLogSample sample;
+  bool eof = false;
+
+  while (true) {
+    if (!eof) {
+      size_t n = fread(buffer + filled, 1, sizeof(buffer) - filled, in);
+      if (n == 0) eof = true;
+      filled += n;
+    }
+    reader.setData(buffer, filled);
+
+    int8_t result;
+    while ((result = reader.next(&sample)) > 0) {
+      if (result == I2CDEV_LOG_DESCRIPTOR) {
+        const I2CdevLogSource *s = reader.getSource(reader.getLastSource());
+        printf("# timestamp_us,device");
+        for (uint8_t i = 0; i < s -> channels; i++) printf(",%s", s -> labels[i]);
+        printf("\n");
+        continue;
+      }
+      const I2CdevLogSource *s = reader.getSource(sample.source);
+      printf("%u,%s", sample.timestamp, s -> name);
+      for (uint8_t i = 0; i < s -> channels; i++) {
+        if (raw) printf(",%d", sample.data[i]);
+        else printf(",%.6g", sample.data[i] * s -> scales[i]);
+      }
+      printf("\n");
+    }
+    if (result == I2CDEV_LOG_ERROR) {
+      fprintf(stderr, "bad record at byte offset %u of the current block\n", reader.getOffset());
+      return 1;
+    }
+
+    // keep the unread tail (a partial record) and read more after it
+    uint32_t offset = reader.getOffset();
+    memmove(buffer, buffer + offset, filled - offset);
+    filled -= offset;
+    if (eof) {
+      if (filled) fprintf(stderr, "log ends inside a record (%u bytes left)\n", filled);
+      break;
+    }
+  }
+  if (in != stdin) fclose(in);
+  return 0;
+}
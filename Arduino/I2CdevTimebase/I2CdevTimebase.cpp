@@ -0,0 +1,217 @@
+// I2Cdev library collection - timestamped samples and sensor timebase
+// Reconstructs per-sample timestamps from host read times and the sensor's output data rate
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "I2CdevTimebase.h"
+
+/** Constructor.
+ * @param periodUs Nominal sample period in microseconds (1000000 / ODR), or
+ *        0 if not known yet: until setNominalPeriod() is called every batch
+ *        is then stamped with its read time
+ */
+I2CdevTimebase::I2CdevTimebase(uint32_t periodUs) {
+    dropped = 0;
+    setNominalPeriod(periodUs);
+}
+
+/** Set the sample period expected from the sensor configuration and restart
+ * the timeline. Call whenever the sensor's output data rate changes.
+ * @param periodUs Nominal sample period in microseconds (1000000 / ODR)
+ */
+void I2CdevTimebase::setNominalPeriod(uint32_t periodUs) {
+    nominal = periodUs << 8;
+    reset();
+}
+
+/** Restart the timeline. The next update() takes its read time as the time of
+ * the newest sample, and the period estimate starts again from the nominal
+ * period. Sequence numbers restart at 0; the dropped count is kept.
+ */
+void I2CdevTimebase::reset() {
+    period = nominal;
+    slew = nominal >> 4;
+    newest = 0;
+    newestFraction = 0;
+    batchCount = 0;
+    sequence = 0;
+    anchored = false;
+    locked = false;
+    synced = false;
+}
+
+/** Place a batch of samples on the timeline.
+ * The timeline is an upper bound: the newest sample of a batch cannot have
+ * been taken after the batch was read, so a prediction later than the read
+ * time is pulled back to it. Between those corrections the timeline runs
+ * slightly slow on purpose, by a little more than the period estimate may be
+ * off (1/16 of the period until it has been measured), which keeps it close
+ * behind the reads with the shortest delay. The period is the slope between
+ * two such corrections at least I2CDEV_TIMEBASE_MIN_SPAN samples apart.
+ * @param readTime Host time in microseconds right after the batch's sample
+ *        count (or, for a polled sensor, the sample itself) was read, so that
+ *        every sample in the batch is known to be older
+ * @param count Number of samples in the batch (FIFO count, or 1 for a polled
+ *        sensor gated on its data ready flag)
+ * @return Timestamp of the oldest sample in the batch
+ * @see getTimestamp()
+ */
+uint32_t I2CdevTimebase::update(uint32_t readTime, uint16_t count) {
+    if (count == 0) return newest;
+    batchCount = count;
+
+    if (!synced) {
+        newest = readTime;
+        newestFraction = 0;
+        sequence += count;
+        anchorTime = readTime;
+        anchorSequence = sequence;
+        anchored = true;
+        synced = true;
+        return getTimestamp(0);
+    }
+
+    uint32_t periodUs = period >> 8;
+    uint64_t advance = (uint64_t)count * (period + slew) + newestFraction;
+    uint32_t predicted = newest + (uint32_t)(advance >> 8);
+    uint8_t fraction = advance & 0xFF;
+    int32_t error = (int32_t)(readTime - predicted);
+
+    if (error < -(int32_t)(count * periodUs)) {
+        // read before even the oldest sample of the batch could exist: bad count or clock jump
+        synced = false;
+        sequence = 0;
+        return update(readTime, count);
+    } else if (error <= 0 || periodUs == 0) {
+        // no nominal period (or under 1 us) also ends up here, so the gap
+        // check below never divides by zero
+        predicted = readTime;
+        fraction = 0;
+        if (!anchored) {
+            anchorTime = readTime;
+            anchorSequence = sequence + count;
+            anchored = true;
+        } else {
+            uint32_t elapsed = readTime - anchorTime;
+            uint32_t span = sequence + count - anchorSequence;
+            if (span >= I2CDEV_TIMEBASE_MIN_SPAN) {
+                uint32_t estimate = ((uint64_t)elapsed << 8) / span;
+                if (estimate > nominal + nominal / 8) estimate = nominal + nominal / 8;
+                if (estimate < nominal - nominal / 8) estimate = nominal - nominal / 8;
+                period = estimate;
+                locked = true;
+
+                // either end may be off by up to a period, so the estimate is
+                // good to about period / span
+                slew = estimate / span;
+                if (slew < (estimate >> 10)) slew = estimate >> 10;
+            }
+            if (elapsed >= I2CDEV_TIMEBASE_MAX_SPAN) {
+                anchorTime = readTime;
+                anchorSequence = sequence + count;
+            }
+        }
+    } else if (locked && (uint32_t)error > periodUs + periodUs / 8) {
+        // more than a period (plus some jitter) late: samples went missing before this batch
+        uint32_t missed = (error - periodUs / 8) / periodUs;
+        dropped += missed;
+        sequence += missed;
+        advance = (uint64_t)missed * period + fraction;
+        predicted += (uint32_t)(advance >> 8);
+        fraction = advance & 0xFF;
+
+        // the exact number lost is a guess, keep it out of the period estimate
+        anchored = false;
+    }
+    newest = predicted;
+    newestFraction = fraction;
+    sequence += count;
+    return getTimestamp(0);
+}
+
+/** Place a batch on the timeline and fill in the records' timing fields.
+ * samples[0] is the oldest sample; data and source are left untouched.
+ * @param samples Records of the batch, oldest first
+ * @param count Number of records
+ * @param readTime Host time in microseconds, as for update()
+ * @see update()
+ */
+void I2CdevTimebase::stamp(I2CdevSample *samples, uint16_t count, uint32_t readTime) {
+    update(readTime, count);
+    uint32_t first = getFirstSequence();
+    for (uint16_t i = 0; i < count; i++) {
+        samples[i].timestamp = getTimestamp(i);
+        samples[i].sequence = first + i;
+    }
+}
+
+/** Get the timestamp of a sample of the last batch.
+ * @param index Position in the batch, 0 for the oldest
+ * @return Timestamp in microseconds
+ */
+uint32_t I2CdevTimebase::getTimestamp(uint16_t index) {
+    uint16_t age = batchCount - 1 - index;
+    return newest - (uint32_t)(((uint64_t)age * period + 128) >> 8);
+}
+
+/** Get the sequence number of the oldest sample of the last batch.
+ * A gap to the previous batch's last number means samples were dropped.
+ * @return Sequence number
+ */
+uint32_t I2CdevTimebase::getFirstSequence() {
+    return sequence - batchCount;
+}
+
+/** Get the estimated sample period.
+ * @return Period in microseconds, rounded
+ */
+uint32_t I2CdevTimebase::getPeriod() {
+    return (period + 128) >> 8;
+}
+
+/** Get the estimated sample period with sub-microsecond resolution.
+ * @return Period in 1/256 us
+ */
+uint32_t I2CdevTimebase::getPeriodQ8() {
+    return period;
+}
+
+/** Check whether the period has been measured.
+ * Until then the nominal period is used and lost samples are not detected.
+ * @return True once the period estimate is based on read times
+ */
+bool I2CdevTimebase::isLocked() {
+    return locked;
+}
+
+/** Get the number of samples detected as lost between batches.
+ * @return Dropped sample count since construction
+ */
+uint32_t I2CdevTimebase::getDropped() {
+    return dropped;
+}
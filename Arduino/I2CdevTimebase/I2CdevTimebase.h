@@ -0,0 +1,94 @@
+// I2Cdev library collection - timestamped samples and sensor timebase header file
+// Reconstructs per-sample timestamps from host read times and the sensor's output data rate
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEVTIMEBASE_H_
+#define _I2CDEVTIMEBASE_H_
+
+#include <stdint.h>
+
+#define I2CDEV_SAMPLE_CHANNELS      6
+
+#define I2CDEV_TIMEBASE_MIN_SPAN    64          // samples between the reads the period is measured from
+#define I2CDEV_TIMEBASE_MAX_SPAN    0x40000000  // us (about 18 minutes) before the estimation baseline restarts
+
+/** One raw sensor sample with its reconstructed time. */
+typedef struct {
+    int16_t data[I2CDEV_SAMPLE_CHANNELS]; // raw values in the driver's order, e.g. ax, ay, az, gx, gy, gz
+    uint32_t timestamp;     // microseconds on the host clock (micros() on Arduino)
+    uint32_t sequence;      // sample number since reset(), counting dropped samples
+    uint8_t source;         // caller-chosen sensor id, to tell merged streams apart
+} I2CdevSample;
+
+/** Timebase for one sensor that produces samples at a fixed output data rate.
+ * The host only knows when it read a batch of samples and how many there
+ * were; the sensor knows when it took them, but only to within its own clock
+ * tolerance. update() combines both: consecutive batches continue one evenly
+ * spaced timeline, the spacing is measured from read times over a long
+ * baseline (so a sensor running a few percent off its nominal rate is
+ * tracked), and the timeline is kept no later than the read time and pulled
+ * gently towards it otherwise. A read that arrives more than a period later
+ * than the timeline allows means samples were lost (FIFO overflow, or a
+ * polled sensor that was not read in time); they are counted as dropped and
+ * skipped in the sequence numbers.
+ */
+class I2CdevTimebase {
+    public:
+        I2CdevTimebase(uint32_t periodUs=0);
+
+        void setNominalPeriod(uint32_t periodUs);
+        void reset();
+
+        uint32_t update(uint32_t readTime, uint16_t count);
+        void stamp(I2CdevSample *samples, uint16_t count, uint32_t readTime);
+        uint32_t getTimestamp(uint16_t index);
+        uint32_t getFirstSequence();
+
+        uint32_t getPeriod();
+        uint32_t getPeriodQ8();
+        uint32_t getDropped();
+        bool isLocked();
+
+    private:
+        uint32_t nominal;           // configured sample period in 1/256 us
+        uint32_t period;            // estimated sample period in 1/256 us
+        uint32_t slew;              // per-sample drift allowance added to period, 1/256 us
+        uint32_t newest;            // timestamp of the newest sample, us
+        uint8_t newestFraction;     // 1/256 us remainder of newest
+        uint16_t batchCount;        // samples in the last update()
+        uint32_t sequence;          // sequence number of the next sample
+        uint32_t anchorTime;        // read time at the start of the estimation baseline
+        uint32_t anchorSequence;    // sequence at the start of the estimation baseline
+        uint32_t dropped;
+        bool anchored;              // anchorTime/anchorSequence are valid
+        bool locked;                // period has been measured
+        bool synced;                // newest/sequence are valid
+};
+
+#endif /* _I2CDEVTIMEBASE_H_ */
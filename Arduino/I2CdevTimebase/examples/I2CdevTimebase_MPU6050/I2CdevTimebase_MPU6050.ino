@@ -0,0 +1,110 @@
+// I2Cdev library collection - I2CdevTimebase MPU6050 FIFO example
+// Streams accel + gyro samples through the MPU6050 FIFO at 200 Hz and gives
+// each one a timestamp on the micros() clock, reconstructed from the FIFO
+// read times and the sample rate configured in SMPLRT_DIV/CONFIG. Prints one
+// line per sample plus the measured sample period and the number of samples
+// lost, e.g. when the loop was too slow and the FIFO overflowed.
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include "Wire.h"
+
+// I2Cdev, I2CdevTimebase and MPU6050 must be installed as libraries, or else
+// the .cpp/.h files must be in the include path of your project
+#include "I2Cdev.h"
+#include "I2CdevTimebase.h"
+#include "MPU6050.h"
+
+#define PACKET_SIZE     12  // accel XYZ + gyro XYZ, big endian
+#define MAX_BATCH       16
+
+MPU6050 accelgyro;
+I2CdevTimebase timebase;
+I2CdevSample samples[MAX_BATCH];
+uint8_t packet[PACKET_SIZE];
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    Wire.begin();
+    Wire.setClock(400000);
+
+    // initialize serial communication
+    Serial.begin(115200);
+
+    // initialize device
+    Serial.println("Initializing I2C devices...");
+    accelgyro.initialize();
+    Serial.println(accelgyro.testConnection() ? "MPU6050 connection successful" : "MPU6050 connection failed");
+
+    // 1 kHz gyro output with the DLPF on, divided by 5
+    accelgyro.setDLPFMode(MPU6050_DLPF_BW_42);
+    accelgyro.setRate(4);
+    timebase.setNominalPeriod(accelgyro.getSamplePeriodMicroseconds());
+
+    accelgyro.setAccelFIFOEnabled(true);
+    accelgyro.setXGyroFIFOEnabled(true);
+    accelgyro.setYGyroFIFOEnabled(true);
+    accelgyro.setZGyroFIFOEnabled(true);
+    accelgyro.setFIFOEnabled(true);
+    accelgyro.resetFIFO();
+}
+
+void loop() {
+    uint16_t count = accelgyro.getFIFOCount() / PACKET_SIZE;
+    uint32_t readTime = micros();
+    if (count == 0) return;
+
+    if (accelgyro.getIntFIFOBufferOverflowStatus()) {
+        // packets are no longer aligned; the gap shows up in the sequence numbers
+        accelgyro.resetFIFO();
+        return;
+    }
+    if (count > MAX_BATCH) count = MAX_BATCH;
+
+    for (uint16_t i = 0; i < count; i++) {
+        accelgyro.getFIFOBytes(packet, PACKET_SIZE);
+        for (uint8_t c = 0; c < I2CDEV_SAMPLE_CHANNELS; c++) {
+            samples[i].data[c] = (((int16_t)packet[c * 2]) << 8) | packet[c * 2 + 1];
+        }
+        samples[i].source = 0;
+    }
+    timebase.stamp(samples, count, readTime);
+
+    for (uint16_t i = 0; i < count; i++) {
+        Serial.print(samples[i].sequence); Serial.print("\t");
+        Serial.print(samples[i].timestamp); Serial.print("\t");
+        for (uint8_t c = 0; c < I2CDEV_SAMPLE_CHANNELS; c++) {
+            Serial.print(samples[i].data[c]); Serial.print("\t");
+        }
+        Serial.println();
+    }
+    Serial.print("# period "); Serial.print(timebase.getPeriodQ8() / 256.0, 2);
+    Serial.print(" us, dropped "); Serial.println(timebase.getDropped());
+}
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2013-07-31 - initial release
+//     2026-10-19 - add readFIFO() burst drain
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -37,6 +38,8 @@ THE SOFTWARE.
  */
 L3G4200D::L3G4200D() {
     devAddr = L3G4200D_DEFAULT_ADDRESS;
+    endianMode = L3G4200D_LITTLE_ENDIAN;
+    selectFIFODecoder();
 }
 
 /** Specific address constructor.
@@ -46,6 +49,8 @@ L3G4200D::L3G4200D() {
  */
 L3G4200D::L3G4200D(uint8_t address) {
     devAddr = address;
+    endianMode = L3G4200D_LITTLE_ENDIAN;
+    selectFIFODecoder();
 }
 
 /** Power on and prepare for general usage.
@@ -62,6 +67,8 @@ void L3G4200D::initialize() {
     I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG3, 0b00000000);
     I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG4, 0b00000000);
     I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG5, 0b00000000);
+    endianMode = L3G4200D_LITTLE_ENDIAN;
+    selectFIFODecoder();
 }
 
 /** Verify the I2C connection.
@@ -579,6 +586,8 @@ bool L3G4200D::getBlockDataUpdateEnabled() {
 void L3G4200D::setEndianMode(bool endianness) {
 	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT, 
 		endianness);
+	endianMode = getEndianMode();
+	selectFIFODecoder();
 }
 
 /** Get the data endian mode
@@ -1102,6 +1111,61 @@ uint8_t L3G4200D::getFIFOStoredDataLevel() {
     return buffer[0];
 }
 
+// FIFO burst drain
+
+/** Read every sample stored in the FIFO with as few transactions as possible.
+ * The stored data level is read once from FIFO_SRC (an overrun counts as a
+ * full FIFO of 32), then the samples are pulled with auto-increment reads
+ * from OUT_X_L; with the FIFO enabled the register address wraps from
+ * OUT_Z_H back to OUT_X_L, so one burst returns consecutive samples. The
+ * burst is split on sample boundaries every 21 samples (readBytes() reports
+ * the byte count as int8_t) or sooner where the I2C layer limits the
+ * transfer size (I2CDEVLIB_WIRE_BUFFER_LENGTH). Byte order is resolved when the
+ * endian mode is set, so samples are decoded in place without a per-sample
+ * branch.
+ * @param samples Buffer for up to maxCount samples, stored as x, y, z triplets
+ * @param maxCount Maximum number of samples to read (up to 32)
+ * @return Number of samples read
+ * @see setFIFOEnabled()
+ * @see setFIFOMode()
+ * @see L3G4200D_RA_FIFO_SRC
+ */
+uint8_t L3G4200D::readFIFO(int16_t *samples, uint8_t maxCount) {
+    I2Cdev::readByte(devAddr, L3G4200D_RA_FIFO_SRC, buffer);
+    uint8_t count = (buffer[0] & (1 << L3G4200D_FIFO_OVRN_BIT)) ? 32 : (buffer[0] & 0x1F);
+    if (count > maxCount) count = maxCount;
+
+    // at most 21 samples (126 bytes) per read, readBytes() returns the count as int8_t
+#ifdef I2CDEVLIB_WIRE_BUFFER_LENGTH
+    const uint8_t chunk = I2CDEVLIB_WIRE_BUFFER_LENGTH >= 126 ? 21 : I2CDEVLIB_WIRE_BUFFER_LENGTH >= 6 ? I2CDEVLIB_WIRE_BUFFER_LENGTH / 6 : 1;
+#else
+    const uint8_t chunk = 21;
+#endif
+    uint8_t *raw = (uint8_t *)samples;
+    uint8_t done = 0;
+    while (done < count) {
+        uint8_t n = count - done < chunk ? count - done : chunk;
+        if (I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L | 0x80, n * 6, raw + done * 6) != n * 6) break;
+        done += n;
+    }
+
+    if (fifoSwap) {
+        for (uint16_t i = 0; i < done * 6; i += 2) {
+            uint8_t b = raw[i];
+            raw[i] = raw[i + 1];
+            raw[i + 1] = b;
+        }
+    }
+    return done;
+}
+
+/** Work out once whether FIFO data needs byte swapping on this host. */
+void L3G4200D::selectFIFODecoder() {
+    const uint16_t probe = 1;
+    bool hostLittleEndian = *(const uint8_t *)&probe == 1;
+    fifoSwap = (endianMode == L3G4200D_LITTLE_ENDIAN) != hostLittleEndian;
+}
+
 // INT1_CFG register, r/w
 
 /** Set the combination mode for interrupt events
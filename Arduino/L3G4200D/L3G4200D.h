@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2013-07-31 - initial release
+//     2026-10-19 - add readFIFO() burst drain
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -307,6 +308,9 @@ class L3G4200D {
 		bool getFIFOOverrun();
 		bool getFIFOEmpty();
 		uint8_t getFIFOStoredDataLevel();
+
+		// FIFO burst drain
+		uint8_t readFIFO(int16_t *samples, uint8_t maxCount);
 		
 		// INT1_CFG register, r/w
 		void setInterruptCombination(bool combination);
@@ -358,6 +362,10 @@ class L3G4200D {
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        bool    endianMode;
+        bool    fifoSwap;   // device byte order differs from the host's
+
+        void selectFIFODecoder();
 };
 
 #endif /* _L3G4200D_H_ */
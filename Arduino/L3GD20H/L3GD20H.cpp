@@ -5,6 +5,9 @@
 //
 // Changelog:
 //     2015-03-05 - initial release
+//     2026-10-19 - add readFIFO() burst drain
+//     2026-10-19 - initialize() writes CTRL1-CTRL5 in one burst from a config table
+//     2026-10-19 - initialize() registers the 400 kHz bus clock limit with I2Cdev
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -31,6 +34,7 @@ THE SOFTWARE.
 */
 
 #include "L3GD20H.h"
+#include "I2CdevConfig.h"
 
 /** Default constructor, uses default I2C address.
  * @see L3GD20H_DEFAULT_ADDRESS
@@ -38,6 +42,7 @@ THE SOFTWARE.
 L3GD20H::L3GD20H() {
     devAddr = L3GD20H_DEFAULT_ADDRESS;
     endianMode = 0;
+    selectFIFODecoder();
 }
 
 /** Specific address constructor.
@@ -48,8 +53,19 @@ L3GD20H::L3GD20H() {
 L3GD20H::L3GD20H(uint8_t address) {
     devAddr = address;
     endianMode = 0;
+    selectFIFODecoder();
 }
 
+static const I2CdevConfigStep initializeProfile[] PROGMEM = {
+    // CTRL1..CTRL5 go out as one auto-increment write
+    I2CDEV_CONFIG_WRITE(L3GD20H_RA_CTRL1, 0b00001111),
+    I2CDEV_CONFIG_WRITE(L3GD20H_RA_CTRL2, 0b00000000),
+    I2CDEV_CONFIG_WRITE(L3GD20H_RA_CTRL3, 0b00000000),
+    I2CDEV_CONFIG_WRITE(L3GD20H_RA_CTRL4, 0b00000000),
+    I2CDEV_CONFIG_WRITE(L3GD20H_RA_CTRL5, 0b00000000),
+    I2CDEV_CONFIG_END
+};
+
 /** Power on and prepare for general usage.
  * All values are defaults except for the power on bit in CTRL_1
  * @see L3GD20H_RA_CTRL1
@@ -59,11 +75,10 @@ L3GD20H::L3GD20H(uint8_t address) {
  * @see L3GD20H_RA_CTRL5
  */
 void L3GD20H::initialize() {
-	I2Cdev::writeByte(devAddr, L3GD20H_RA_CTRL1, 0b00001111);
-    I2Cdev::writeByte(devAddr, L3GD20H_RA_CTRL2, 0b00000000);
-    I2Cdev::writeByte(devAddr, L3GD20H_RA_CTRL3, 0b00000000);
-    I2Cdev::writeByte(devAddr, L3GD20H_RA_CTRL4, 0b00000000);
-    I2Cdev::writeByte(devAddr, L3GD20H_RA_CTRL5, 0b00000000);
+    I2Cdev::setDeviceClock(devAddr, L3GD20H_MAX_CLOCK_HZ);
+    I2CdevConfig::apply(devAddr, initializeProfile, 0, 0x80);
+    endianMode = L3GD20H_LITTLE_ENDIAN;
+    selectFIFODecoder();
 }
 
 /** Verify the I2C connection.
@@ -622,6 +637,7 @@ void L3GD20H::setEndianMode(bool endianness) {
 	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL4, L3GD20H_BLE_BIT, 
 		endianness);
 	endianMode = getEndianMode();
+	selectFIFODecoder();
 }
 
 /** Get the data endian mode
@@ -1191,6 +1207,61 @@ uint8_t L3GD20H::getFIFOStoredDataLevel() {
     return buffer[0];
 }
 
+// FIFO burst drain
+
+/** Read every sample stored in the FIFO with as few transactions as possible.
+ * The stored data level is read once from FIFO_SRC (an overrun counts as a
+ * full FIFO of 32), then the samples are pulled with auto-increment reads
+ * from OUT_X_L; with the FIFO enabled the register address wraps from
+ * OUT_Z_H back to OUT_X_L, so one burst returns consecutive samples. The
+ * burst is split on sample boundaries every 21 samples (readBytes() reports
+ * the byte count as int8_t) or sooner where the I2C layer limits the
+ * transfer size (I2CDEVLIB_WIRE_BUFFER_LENGTH). Byte order is resolved when the
+ * endian mode is set, so samples are decoded in place without a per-sample
+ * branch.
+ * @param samples Buffer for up to maxCount samples, stored as x, y, z triplets
+ * @param maxCount Maximum number of samples to read (up to 32)
+ * @return Number of samples read
+ * @see setFIFOEnabled()
+ * @see setFIFOMode()
+ * @see L3GD20H_RA_FIFO_SRC
+ */
+uint8_t L3GD20H::readFIFO(int16_t *samples, uint8_t maxCount) {
+    I2Cdev::readByte(devAddr, L3GD20H_RA_FIFO_SRC, buffer);
+    uint8_t count = (buffer[0] & (1 << L3GD20H_OVRN_BIT)) ? 32 : (buffer[0] & 0x1F);
+    if (count > maxCount) count = maxCount;
+
+    // at most 21 samples (126 bytes) per read, readBytes() returns the count as int8_t
+#ifdef I2CDEVLIB_WIRE_BUFFER_LENGTH
+    const uint8_t chunk = I2CDEVLIB_WIRE_BUFFER_LENGTH >= 126 ? 21 : I2CDEVLIB_WIRE_BUFFER_LENGTH >= 6 ? I2CDEVLIB_WIRE_BUFFER_LENGTH / 6 : 1;
+#else
+    const uint8_t chunk = 21;
+#endif
+    uint8_t *raw = (uint8_t *)samples;
+    uint8_t done = 0;
+    while (done < count) {
+        uint8_t n = count - done < chunk ? count - done : chunk;
+        if (I2Cdev::readBytes(devAddr, L3GD20H_RA_OUT_X_L | 0x80, n * 6, raw + done * 6) != n * 6) break;
+        done += n;
+    }
+
+    if (fifoSwap) {
+        for (uint16_t i = 0; i < done * 6; i += 2) {
+            uint8_t b = raw[i];
+            raw[i] = raw[i + 1];
+            raw[i + 1] = b;
+        }
+    }
+    return done;
+}
+
+/** Work out once whether FIFO data needs byte swapping on this host. */
+void L3GD20H::selectFIFODecoder() {
+    const uint16_t probe = 1;
+    bool hostLittleEndian = *(const uint8_t *)&probe == 1;
+    fifoSwap = (endianMode == L3GD20H_LITTLE_ENDIAN) != hostLittleEndian;
+}
+
 // IG_CFG register, r/w
 
 /** Set the combination mode for interrupt events
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2015-03-05 - initial release
+//     2026-10-19 - add readFIFO() burst drain
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -37,6 +38,7 @@ THE SOFTWARE.
 
 #define L3GD20H_ADDRESS           0x6B // I think this is correct.  See SAD in doc.
 #define L3GD20H_DEFAULT_ADDRESS   0x6B // I think this is correct.  See SAD in doc.
+#define L3GD20H_MAX_CLOCK_HZ      400000 // fast mode
 
 #define L3GD20H_RA_WHO_AM_I       0x0F
 #define L3GD20H_RA_CTRL1      0x20
@@ -326,6 +328,9 @@ class L3GD20H {
 		bool getFIFOOverrun();
 		bool getFIFOEmpty();
 		uint8_t getFIFOStoredDataLevel();
+
+		// FIFO burst drain
+		uint8_t readFIFO(int16_t *samples, uint8_t maxCount);
 		
 		// IG_CFG register, r/w
 		void setInterruptCombination(bool combination);
@@ -393,6 +398,9 @@ class L3GD20H {
         uint8_t devAddr;
         uint8_t buffer[6];
         bool 	endianMode;
+        bool    fifoSwap;   // device byte order differs from the host's
+
+        void selectFIFODecoder();
 };
 
 #endif /* _L3GD20H_H_ */
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2015-03-10 - initial release
+//     2026-10-19 - initialize() runs per-device config tables
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -31,6 +32,7 @@ THE SOFTWARE.
 */
 
 #include "LSM303DLHC.h"
+#include "I2CdevConfig.h"
 
 /** Default constructor, uses default I2C address.
  * @see LSM303DLHC_DEFAULT_ADDRESS_A
@@ -40,6 +42,8 @@ LSM303DLHC::LSM303DLHC() {
     devAddrA = LSM303DLHC_DEFAULT_ADDRESS_A;
     devAddrM = LSM303DLHC_DEFAULT_ADDRESS_M;
     endianMode = 0;
+    samplerPeriod = 0;
+    magCache[0] = magCache[1] = magCache[2] = 0;
 }
 
 /** Specific address constructor.
@@ -54,8 +58,20 @@ LSM303DLHC::LSM303DLHC(uint8_t addressA, uint8_t addressM) {
     devAddrA = addressA;
     devAddrM = addressM;
     endianMode = 0;
+    samplerPeriod = 0;
+    magCache[0] = magCache[1] = magCache[2] = 0;
 }
 
+static const I2CdevConfigStep initializeProfileA[] PROGMEM = {
+    I2CDEV_CONFIG_WRITE(LSM303DLHC_RA_CTRL_REG1_A, 0b01100111),
+    I2CDEV_CONFIG_END
+};
+
+static const I2CdevConfigStep initializeProfileM[] PROGMEM = {
+    I2CDEV_CONFIG_WRITE(LSM303DLHC_RA_CRA_REG_M, 0b00011100),
+    I2CDEV_CONFIG_END
+};
+
 /** Power on and prepare for general usage.
 All values are defaults except for the data rates for the accelerometer and
 magnetometer data rates (200hz and 220hz respectively).
@@ -63,8 +79,8 @@ magnetometer data rates (200hz and 220hz respectively).
 @see LSM303DLHC_RA_CRA_REG_M
 */
 void LSM303DLHC::initialize() {
-    I2Cdev::writeByte(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, 0b01100111);
-    I2Cdev::writeByte(devAddrM, LSM303DLHC_RA_CRA_REG_M, 0b00011100);
+    I2CdevConfig::apply(devAddrA, initializeProfileA, 0, 0x80);
+    I2CdevConfig::apply(devAddrM, initializeProfileM);
     // ----------------------------------------------------------------------------
     // STUB TODO:
     // Perform any important initialization here. Maybe nothing is required, but
@@ -2147,3 +2163,92 @@ uint8_t LSM303DLHC::getDeviceID() {
     // I2Cdev::readByte(devAddrA, LSM303DLHC_RA_WHO_AM_I, buffer);
     // return buffer[0];
 }
+
+// combined accel/mag sampling
+
+/** Prepare the accelerometer FIFO and magnetometer for readSamples().
+ * Sets the accelerometer output data rate, empties the FIFO by passing
+ * through bypass mode, then enables it in stream mode so the newest 32
+ * samples are always kept. The magnetometer is put in continuous mode at
+ * whatever rate it is already configured for; readSamples() only fetches
+ * it when its DRDY bit is set.
+ * @param accelRate Accelerometer output data rate in Hz (see setAccelOutputDataRate())
+ * @see readSamples()
+ * @see LSM303DLHC_FM_STREAM
+ */
+void LSM303DLHC::initializeSampler(uint16_t accelRate) {
+    setAccelOutputDataRate(accelRate);
+    samplerPeriod = accelRate ? 1000000UL / accelRate : 0;
+    setAccelFIFOMode(LSM303DLHC_FM_BYBASS);
+    setAccelFIFOEnabled(true);
+    setAccelFIFOMode(LSM303DLHC_FM_STREAM);
+    setMagMode(LSM303DLHC_MD_CONTINUOUS);
+    getMag(&magCache[0], &magCache[1], &magCache[2]);
+}
+
+/** Drain the accelerometer FIFO and pair it with the magnetometer.
+ * FIFO_SRC_REG_A is read once for the stored sample count and the samples
+ * are pulled with auto-increment reads from OUT_X_L_A, which wrap back to
+ * OUT_X_L_A while the FIFO is enabled. The reads are split on sample
+ * boundaries every 21 samples (readBytes() reports the byte count as
+ * int8_t) or sooner where the I2C layer limits the transfer size. The
+ * magnetometer runs much slower than the accelerometer, so SR_REG_M is
+ * checked once and the magnetometer output is read only if DRDY is set.
+ * A new reading is attached to the newest accel sample and the cached one
+ * to all the others. Timestamps count back from the given time of the
+ * newest stored sample at the accel output data rate; samples beyond
+ * maxCount stay in the FIFO for the next call.
+ * @param samples Buffer for up to maxCount samples, oldest first
+ * @param maxCount Maximum number of samples to read (up to 32)
+ * @param timestamp Time of the newest stored sample in microseconds, e.g. micros()
+ * @return Number of samples read
+ * @see initializeSampler()
+ * @see LSM303DLHC_RA_FIFO_SRC_REG_A
+ * @see LSM303DLHC_RA_SR_REG_M
+ */
+uint8_t LSM303DLHC::readSamples(LSM303DLHCSample *samples, uint8_t maxCount, uint32_t timestamp) {
+    // at most 21 samples (126 bytes) per read, readBytes() returns the count as int8_t
+#ifdef I2CDEVLIB_WIRE_BUFFER_LENGTH
+    const uint8_t chunk = I2CDEVLIB_WIRE_BUFFER_LENGTH >= 126 ? 21 : I2CDEVLIB_WIRE_BUFFER_LENGTH >= 6 ? I2CDEVLIB_WIRE_BUFFER_LENGTH / 6 : 1;
+#else
+    const uint8_t chunk = 21;
+#endif
+    uint8_t raw[chunk * 6];
+    uint8_t lo = endianMode == LSM303DLHC_LITTLE_ENDIAN ? 0 : 1;
+
+    I2Cdev::readByte(devAddrA, LSM303DLHC_RA_FIFO_SRC_REG_A, buffer);
+    uint8_t stored = (buffer[0] & (1 << LSM303DLHC_OVRN_FIFO_BIT)) ? LSM303DLHC_FIFO_DEPTH : (buffer[0] & 0x1F);
+    uint8_t count = stored > maxCount ? maxCount : stored;
+
+    uint8_t done = 0;
+    while (done < count) {
+        uint8_t n = count - done < chunk ? count - done : chunk;
+        if (I2Cdev::readBytes(devAddrA, LSM303DLHC_RA_OUT_X_L_A | 0x80, n * 6, raw) != n * 6) break;
+        for (uint8_t i = 0; i < n; i++) {
+            const uint8_t *p = raw + i * 6;
+            LSM303DLHCSample *s = &samples[done + i];
+            s->ax = (((int16_t)p[1 - lo]) << 8) | p[lo];
+            s->ay = (((int16_t)p[3 - lo]) << 8) | p[2 + lo];
+            s->az = (((int16_t)p[5 - lo]) << 8) | p[4 + lo];
+        }
+        done += n;
+    }
+    if (done == 0) return 0;
+
+    bool magUpdated = false;
+    I2Cdev::readByte(devAddrM, LSM303DLHC_RA_SR_REG_M, buffer);
+    if (buffer[0] & (1 << LSM303DLHC_M_DRDY_BIT)) {
+        getMag(&magCache[0], &magCache[1], &magCache[2]);
+        magUpdated = true;
+    }
+
+    for (uint8_t i = 0; i < done; i++) {
+        LSM303DLHCSample *s = &samples[i];
+        s->mx = magCache[0];
+        s->my = magCache[1];
+        s->mz = magCache[2];
+        s->magUpdated = magUpdated && i == done - 1;
+        s->timestamp = timestamp - (uint32_t)(stored - 1 - i) * samplerPeriod;
+    }
+    return done;
+}
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2015-03-15 - initial release
+//     2026-10-19 - add combined accel FIFO + mag sampler (initializeSampler/readSamples)
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -377,6 +378,15 @@ THE SOFTWARE.
 
 
 
+#define LSM303DLHC_FIFO_DEPTH       32
+
+typedef struct {
+    int16_t ax, ay, az;
+    int16_t mx, my, mz;         // latest magnetometer reading at this sample's time
+    uint32_t timestamp;         // microseconds, reconstructed from the accel output data rate
+    bool magUpdated;            // mx/my/mz were read from the device in this call
+} LSM303DLHCSample;
+
 class LSM303DLHC {
     public:
         LSM303DLHC();
@@ -638,6 +648,10 @@ class LSM303DLHC {
         // WHO_AM_I register, read-only
         uint8_t getDeviceID();
 
+        // combined accel/mag sampling
+        void initializeSampler(uint16_t accelRate);
+        uint8_t readSamples(LSM303DLHCSample *samples, uint8_t maxCount, uint32_t timestamp);
+
 // ----------------------------------------------------------------------------
 // STUB TODO:
 // Declare private object helper variables or local storage for particular
@@ -653,6 +667,8 @@ class LSM303DLHC {
         uint8_t devAddrM;
         uint8_t buffer[6];
         bool endianMode;
+        uint32_t samplerPeriod;     // accel sample period in microseconds
+        int16_t magCache[3];        // last magnetometer reading, x/y/z
 };
 
 #endif /* _LSM303DLHC_H_ */
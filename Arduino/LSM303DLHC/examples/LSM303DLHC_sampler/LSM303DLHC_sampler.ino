@@ -0,0 +1,75 @@
+// I2C device class (I2Cdev) demonstration Arduino sketch for LSM303DLHC class
+// Drains the accelerometer FIFO at 400 Hz every 50 ms and prints each
+// sample with the magnetometer reading taken at (or before) its time
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2011 Jonathan Arnett, Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+// Arduino Wire library is required if I2Cdev I2CDEV_ARDUINO_WIRE implementation
+// is used in I2Cdev.h
+#include <Wire.h>
+
+// I2Cdev and LSM303DLHC must be installed as libraries, or else the .cpp/.h files
+// for both classes must be in the include path of your project
+#include <I2Cdev.h>
+#include <LSM303DLHC.h>
+
+LSM303DLHC accelMag;
+LSM303DLHCSample samples[LSM303DLHC_FIFO_DEPTH];
+
+void setup() {
+    // join I2C bus (I2Cdev library doesn't do this automatically)
+    Wire.begin();
+    Serial.begin(115200);
+
+    // initialize device
+    Serial.println("Initializing I2C devices...");
+    accelMag.initialize();
+    Serial.println(accelMag.testConnection() ? "LSM303DLHC connection successful" : "LSM303DLHC connection failed");
+
+    // the magnetometer tops out at 220 Hz, so most accel samples reuse the
+    // last mag reading and only the newest one of a batch gets a fresh one
+    accelMag.setMagOutputDataRate(75);
+    accelMag.initializeSampler(400);
+}
+
+void loop() {
+    uint8_t count = accelMag.readSamples(samples, LSM303DLHC_FIFO_DEPTH, micros());
+    for (uint8_t i = 0; i < count; i++) {
+        LSM303DLHCSample *s = &samples[i];
+        Serial.print(s->timestamp); Serial.print("\t");
+        Serial.print(s->ax); Serial.print("\t");
+        Serial.print(s->ay); Serial.print("\t");
+        Serial.print(s->az); Serial.print("\t");
+        Serial.print(s->mx); Serial.print("\t");
+        Serial.print(s->my); Serial.print("\t");
+        Serial.print(s->mz);
+        Serial.println(s->magUpdated ? "\t*" : "");
+    }
+    delay(50);
+}
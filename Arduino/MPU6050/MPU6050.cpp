@@ -4,6 +4,13 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//  2026-10-19 - FIFO reads keep INT_STATUS for getLastIntStatus(), estimate packets lost in overflows
+//  2026-10-19 - GetCurrentFIFOPacket() resyncs after overflows without a reset where it can, counts lost packets
+//  2026-10-19 - getFIFOBytes() reads any length with one address phase (I2Cdev::readStream)
+//  2026-10-19 - initialize() registers the 400 kHz bus clock limit with I2Cdev
+//  2026-10-19 - initialize() runs a register table (I2CdevConfig), 3 bus transactions instead of 8
+//  2026-10-19 - bit field accessors use I2CdevRegisterField where that makes them smaller
+//  2026-10-19 - add getSamplePeriodMicroseconds()
 //  2021-09-27 - split implementations out of header files, finally
 //  2019-07-08 - Added Auto Calibration routine
 //     ... - ongoing debug release
@@ -37,6 +44,8 @@ THE SOFTWARE.
 */
 
 #include "MPU6050.h"
+#include "I2CdevRegister.h"
+#include "I2CdevConfig.h"
 
 /** Specific address constructor.
  * @param address I2C address, uses default I2C address if none is specified
@@ -47,18 +56,27 @@ THE SOFTWARE.
 MPU6050_Base::MPU6050_Base(uint8_t address, void *wireObj):devAddr(address), wireObj(wireObj) {
 }
 
+static const I2CdevConfigStep initializeProfile[] PROGMEM = {
+    I2CDEV_CONFIG_MODIFY(MPU6050_RA_PWR_MGMT_1, 0x47, MPU6050_CLOCK_PLL_XGYRO), // SLEEP off (thanks to Jack Elston for pointing this one out!), CLKSEL X gyro
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_GYRO_CONFIG, 0x00),  // no self-test, +/- 250 deg/sec
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_ACCEL_CONFIG, 0x00), // no self-test, +/- 2g, DHPF reset
+    I2CDEV_CONFIG_END
+};
+
 /** Power on and prepare for general usage.
  * This will activate the device and take it out of sleep mode (which must be done
  * after start-up). This function also sets both the accelerometer and the gyroscope
  * to their most sensitive settings, namely +/- 2g and +/- 250 degrees/sec, and sets
  * the clock source to use the X Gyro for reference, which is slightly better than
- * the default internal clock source.
+ * the default internal clock source. The device's maximum bus clock is
+ * registered with I2Cdev::setDeviceClock(), so a faster bus clock set with
+ * I2Cdev::setBusClock() is lowered to fast mode for its transfers. That is a
+ * no-op where the clock table is compiled out (I2CDEV_DEVICE_CLOCKS 0, the
+ * default on AVR).
  */
 void MPU6050_Base::initialize() {
-    setClockSource(MPU6050_CLOCK_PLL_XGYRO);
-    setFullScaleGyroRange(MPU6050_GYRO_FS_250);
-    setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
-    setSleepEnabled(false); // thanks to Jack Elston for pointing this one out!
+    I2Cdev::setDeviceClock(devAddr, MPU6050_MAX_CLOCK_HZ, wireObj);
+    I2CdevConfig::apply(devAddr, initializeProfile, wireObj);
 }
 
 /** Verify the I2C connection.
@@ -197,7 +215,7 @@ void MPU6050_Base::setExternalFrameSync(uint8_t sync) {
  * @see MPU6050_CFG_DLPF_CFG_LENGTH
  */
 uint8_t MPU6050_Base::getDLPFMode() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevRegisterField<MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set digital low-pass filter configuration.
@@ -209,7 +227,23 @@ uint8_t MPU6050_Base::getDLPFMode() {
  * @see MPU6050_CFG_DLPF_CFG_LENGTH
  */
 void MPU6050_Base::setDLPFMode(uint8_t mode) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH, mode, wireObj);
+    I2CdevRegisterField<MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH>::write(devAddr, mode, wireObj);
+}
+
+/** Get the interval between samples in the FIFO and sensor registers.
+ * Reads SMPLRT_DIV and CONFIG in one burst and applies the Sample Rate
+ * formula from getRate(): the gyroscope output rate is 8kHz with DLPF_CFG 0
+ * or 7 and 1kHz otherwise. Useful as the nominal period of an
+ * I2CdevTimebase.
+ * @return Sample period in microseconds
+ * @see getRate()
+ * @see getDLPFMode()
+ */
+uint32_t MPU6050_Base::getSamplePeriodMicroseconds() {
+    I2Cdev::readBytes(devAddr, MPU6050_RA_SMPLRT_DIV, 2, buffer, I2Cdev::readTimeout, wireObj);
+    uint8_t dlpf = buffer[1] & 0x07;
+    uint32_t gyroPeriod = (dlpf == 0 || dlpf == 7) ? 125 : 1000;
+    return gyroPeriod * (1 + (uint32_t)buffer[0]);
 }
 
 // GYRO_CONFIG register
@@ -416,7 +450,7 @@ void MPU6050_Base::setFullScaleAccelRange(uint8_t range) {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 uint8_t MPU6050_Base::getDHPFMode() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevRegisterField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set the high-pass filter configuration.
@@ -426,7 +460,7 @@ uint8_t MPU6050_Base::getDHPFMode() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050_Base::setDHPFMode(uint8_t bandwidth) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH, bandwidth, wireObj);
+    I2CdevRegisterField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH>::write(devAddr, bandwidth, wireObj);
 }
 
 // FF_THR register
@@ -896,7 +930,7 @@ void MPU6050_Base::setSlaveReadWriteTransitionEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 uint8_t MPU6050_Base::getMasterClockSpeed() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevRegisterField<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set I2C master clock speed.
@@ -904,7 +938,7 @@ uint8_t MPU6050_Base::getMasterClockSpeed() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050_Base::setMasterClockSpeed(uint8_t speed) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH, speed, wireObj);
+    I2CdevRegisterField<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH>::write(devAddr, speed, wireObj);
 }
 
 // I2C_SLV* registers (Slave 0-3)
@@ -1240,7 +1274,7 @@ void MPU6050_Base::setSlave4WriteMode(bool mode) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 uint8_t MPU6050_Base::getSlave4MasterDelay() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevRegisterField<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Slave 4 master delay value.
@@ -1249,7 +1283,7 @@ uint8_t MPU6050_Base::getSlave4MasterDelay() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050_Base::setSlave4MasterDelay(uint8_t delay) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH, delay, wireObj);
+    I2CdevRegisterField<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH>::write(devAddr, delay, wireObj);
 }
 /** Get last available byte read from Slave 4.
  * This register stores the data read from Slave 4. This field is populated
@@ -2247,7 +2281,7 @@ uint8_t MPU6050_Base::getAccelerometerPowerOnDelay() {
  * @see MPU6050_DETECT_ACCEL_ON_DELAY_BIT
  */
 void MPU6050_Base::setAccelerometerPowerOnDelay(uint8_t delay) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH, delay, wireObj);
+    I2CdevRegisterField<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH>::write(devAddr, delay, wireObj);
 }
 /** Get Free Fall detection counter decrement configuration.
  * Detection is registered by the Free Fall detection module after accelerometer
@@ -2312,7 +2346,7 @@ void MPU6050_Base::setFreefallDetectionCounterDecrement(uint8_t decrement) {
  *
  */
 uint8_t MPU6050_Base::getMotionDetectionCounterDecrement() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevRegisterField<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Motion detection counter decrement configuration.
@@ -2322,7 +2356,7 @@ uint8_t MPU6050_Base::getMotionDetectionCounterDecrement() {
  * @see MPU6050_DETECT_MOT_COUNT_BIT
  */
 void MPU6050_Base::setMotionDetectionCounterDecrement(uint8_t decrement) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH, decrement, wireObj);
+    I2CdevRegisterField<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH>::write(devAddr, decrement, wireObj);
 }
 
 // USER_CTRL register
@@ -2387,6 +2421,8 @@ void MPU6050_Base::switchSPIEnabled(bool enabled) {
  */
 void MPU6050_Base::resetFIFO() {
     I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_RESET_BIT, true, wireObj);
+    fifoCountTime = micros();
+    fifoLeft = 0;
 }
 /** Reset the I2C Master.
  * This bit resets the I2C Master when set to 1 while I2C_MST_EN equals 0.
@@ -2504,7 +2540,7 @@ void MPU6050_Base::setTempSensorEnabled(bool enabled) {
  * @see MPU6050_PWR1_CLKSEL_LENGTH
  */
 uint8_t MPU6050_Base::getClockSource() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevRegisterField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set clock source setting.
@@ -2538,7 +2574,7 @@ uint8_t MPU6050_Base::getClockSource() {
  * @see MPU6050_PWR1_CLKSEL_LENGTH
  */
 void MPU6050_Base::setClockSource(uint8_t source) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH, source, wireObj);
+    I2CdevRegisterField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH>::write(devAddr, source, wireObj);
 }
 
 // PWR_MGMT_2 register
@@ -2567,7 +2603,7 @@ void MPU6050_Base::setClockSource(uint8_t source) {
  * @see MPU6050_RA_PWR_MGMT_2
  */
 uint8_t MPU6050_Base::getWakeFrequency() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevRegisterField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set wake frequency in Accel-Only Low Power Mode.
@@ -2738,9 +2774,16 @@ uint8_t MPU6050_Base::getFIFOByte() {
     I2Cdev::readByte(devAddr, MPU6050_RA_FIFO_R_W, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
-void MPU6050_Base::getFIFOBytes(uint8_t *data, uint8_t length) {
+/** Get a run of bytes from the FIFO buffer.
+ * FIFO_R_W does not advance the register pointer, so the read is streamed
+ * with a single address phase however long it is (up to the 1024 byte FIFO).
+ * @param data Buffer to store the bytes in
+ * @param length Number of bytes to read, at most getFIFOCount()
+ * @see I2Cdev::readStream()
+ */
+void MPU6050_Base::getFIFOBytes(uint8_t *data, uint16_t length) {
     if(length > 0){
-        I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_R_W, length, data, I2Cdev::readTimeout, wireObj);
+        I2Cdev::readStream(devAddr, MPU6050_RA_FIFO_R_W, length, data, I2Cdev::readTimeout, wireObj);
     } else {
     	*data = 0;
     }
@@ -2762,48 +2805,185 @@ void MPU6050_Base::setFIFOTimeout(uint32_t fifoTimeout) {
 	this->fifoTimeout = fifoTimeout;
 }
 
+/** Get FIFO packet counters.
+ * @param stats Receives a copy of the counters
+ * @see MPU6050FIFOStats
+ */
+void MPU6050_Base::getFIFOStats(MPU6050FIFOStats *stats) {
+    *stats = fifoStats;
+}
+
+/** Clear the FIFO packet counters. */
+void MPU6050_Base::resetFIFOStats() {
+    fifoStats.delivered = 0;
+    fifoStats.dropped = 0;
+    fifoStats.overflows = 0;
+    fifoStats.resyncs = 0;
+    fifoStats.resets = 0;
+    fifoStats.invalid = 0;
+    fifoStats.overwritten = 0;
+}
+
+/** Get INT_STATUS as read by the last GetCurrentFIFOPacket() or
+ * getFIFOPackets().
+ * Both read INT_STATUS to detect overflows, which clears its bits, so a
+ * getIntStatus() afterwards would miss e.g. MOT_INT or DMP_INT. Use this
+ * instead of a separate getIntStatus() call.
+ * @return Interrupt status byte
+ * @see getIntStatus()
+ */
+uint8_t MPU6050_Base::getLastIntStatus() {
+    return lastIntStatus;
+}
+
+/** Discard bytes from the head of the FIFO.
+ * Reads in chunks of up to I2CDEVLIB_WIRE_BUFFER_LENGTH and stops early if,
+ * at the pace of the chunks read so far, the rest would not be done before
+ * the FIFO timeout (counted from startTime) runs out.
+ * @param length Number of bytes to discard
+ * @param startTime micros() at the start of the caller's timeout
+ * @return True if all bytes were discarded, false if the FIFO is left part
+ *         way through and should be reset
+ */
+bool MPU6050_Base::skipFIFOBytes(uint16_t length, uint32_t startTime) {
+    uint8_t trash[I2CDEVLIB_WIRE_BUFFER_LENGTH];
+    uint32_t skipStart = micros();
+    uint16_t skipped = 0;
+    while (skipped < length) {
+        if (skipped) {
+            uint32_t now = micros();
+            uint32_t rest = (now - skipStart) * (length - skipped) / skipped;
+            if (now - startTime + rest > getFIFOTimeout()) return false;
+        }
+        uint16_t chunk = length - skipped;
+        if (chunk > I2CDEVLIB_WIRE_BUFFER_LENGTH) chunk = I2CDEVLIB_WIRE_BUFFER_LENGTH;
+        getFIFOBytes(trash, chunk);
+        skipped += chunk;
+    }
+    return true;
+}
+
+/** Count the packets the chip overwrote in a FIFO overflow.
+ * The FIFO drops the oldest bytes when full. From the bytes left after the
+ * previous read (or reset) and the packets written since at the packet
+ * period, estimate how many whole packets were lost beyond the FIFO size
+ * and add them to the overwritten and dropped counters. The packet split
+ * by the overflow is not included; the caller skips it and counts it.
+ * @param length Packet size
+ * @param now micros() when the overflow was seen
+ */
+void MPU6050_Base::countOverwrittenPackets(uint8_t length, uint32_t now) {
+    if (fifoLeft > MPU6050_FIFO_SIZE) return; // no earlier read to start from
+    uint32_t period = fifoPacketPeriod ? fifoPacketPeriod : getSamplePeriodMicroseconds();
+    uint32_t written = fifoLeft + (now - fifoCountTime) / period * length;
+    if (written <= MPU6050_FIFO_SIZE) return;
+    uint32_t lost = (written - MPU6050_FIFO_SIZE) / length;
+    fifoStats.overwritten += lost;
+    fifoStats.dropped += lost;
+}
+
 /** Get latest byte from FIFO buffer no matter how much time has passed.
  * ===                  GetCurrentFIFOPacket                    ===
  * ================================================================
  * Returns 1) when nothing special was done
  *         2) when recovering from overflow
  *         0) when no valid data is available
- * ================================================================ */
+ * ================================================================
+ * The DMP writes whole packets, so the newest one always ends at the end of
+ * the FIFO even after an overflow has shifted the head off a packet
+ * boundary. Everything before it is skipped, which also realigns the FIFO;
+ * only if skipping would overrun the FIFO timeout is the FIFO reset and the
+ * next packet waited for. Skipped and flushed packets, and an estimate of
+ * those the chip overwrote, are counted in getFIFOStats(). The INT_STATUS
+ * read here is kept for getLastIntStatus().
+ */
  int8_t MPU6050_Base::GetCurrentFIFOPacket(uint8_t *data, uint8_t length) { // overflow proof
-     int16_t fifoC;
-     // This section of code is for when we allowed more than 1 packet to be acquired
      uint32_t BreakTimer = micros();
-     bool packetReceived = false;
-     do {
-         if ((fifoC = getFIFOCount())  > length) {
-
-             if (fifoC > 200) { // if you waited to get the FIFO buffer to > 200 bytes it will take longer to get the last packet in the FIFO Buffer than it will take to  reset the buffer and wait for the next to arrive
-                 resetFIFO(); // Fixes any overflow corruption
-                 fifoC = 0;
-                 while (!(fifoC = getFIFOCount()) && ((micros() - BreakTimer) <= (getFIFOTimeout()))); // Get Next New Packet
-                 } else { //We have more than 1 packet but less than 200 bytes of data in the FIFO Buffer
-                 uint8_t Trash[I2CDEVLIB_WIRE_BUFFER_LENGTH];
-                 while ((fifoC = getFIFOCount()) > length) {  // Test each time just in case the MPU is writing to the FIFO Buffer
-                     fifoC = fifoC - length; // Save the last packet
-                     uint16_t  RemoveBytes;
-                     while (fifoC) { // fifo count will reach zero so this is safe
-                         RemoveBytes = (fifoC < I2CDEVLIB_WIRE_BUFFER_LENGTH) ? fifoC : I2CDEVLIB_WIRE_BUFFER_LENGTH; // Buffer Length is different than the packet length this will efficiently clear the buffer
-                         getFIFOBytes(Trash, (uint8_t)RemoveBytes);
-                         fifoC -= RemoveBytes;
-                     }
+     int8_t result = 1;
+     uint16_t fifoC = getFIFOCount();
+     if (!fifoC) return 0; // Called too early no data
+     lastIntStatus = getIntStatus();
+     if (lastIntStatus & (1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT)) {
+         fifoStats.overflows++;
+         countOverwrittenPackets(length, BreakTimer);
+         result = 2;
+     }
+     for (;; fifoC = getFIFOCount()) {
+         if (fifoC == length) break;
+         if (fifoC > length) {
+             uint16_t skip = fifoC - length; // everything before the newest packet
+             if (skipFIFOBytes(skip, BreakTimer)) {
+                 fifoStats.dropped += (skip + length - 1) / length;
+                 if (skip % length) {
+                     fifoStats.resyncs++;
+                     result = 2;
                  }
+                 continue; // check for packets written in the meantime
              }
+             resetFIFO();
+             fifoStats.resets++;
+             fifoStats.dropped += (fifoC + length - 1) / length;
+             result = 2; // wait for the next packet
          }
-         if (!fifoC) return 0; // Called too early no data or we timed out after FIFO Reset
-         // We have 1 packet
-         packetReceived = fifoC == length;
-         if (!packetReceived && (micros() - BreakTimer) > (getFIFOTimeout())) return 0;
-     } while (!packetReceived);
+         if ((micros() - BreakTimer) > (getFIFOTimeout())) return 0;
+     }
      getFIFOBytes(data, length); //Get 1 packet
-     return 1;
+     fifoCountTime = micros();
+     fifoLeft = 0;
+     fifoStats.delivered++;
+     return result;
+}
+
+/** Get the oldest whole packets from the FIFO, in order.
+ * For consumers that need every sample rather than the newest one. Reads
+ * INT_STATUS (clearing a latched interrupt), FIFO_COUNT and then the
+ * packets in one streamed read. After an overflow the chip has dropped
+ * bytes from the head of the FIFO, so the partial packet there is skipped
+ * to realign, together with one whole packet: a FIFO left with less than a
+ * packet of room would overflow again, and shift the head once more, if the
+ * DMP wrote before the read starts. If that skip would overrun the FIFO
+ * timeout the FIFO is reset instead and nothing is returned. Packets the
+ * chip overwrote are estimated from the time since the previous read and
+ * added to dropped in getFIFOStats(). The INT_STATUS byte is kept for
+ * getLastIntStatus().
+ * @param data Buffer for maxPackets * length bytes
+ * @param maxPackets Most packets to read, the rest stay in the FIFO
+ * @param length Packet size
+ * @return Number of packets read (0 if less than one is waiting)
+ */
+uint16_t MPU6050_Base::getFIFOPackets(uint8_t *data, uint16_t maxPackets, uint8_t length) {
+    lastIntStatus = getIntStatus();
+    bool overflow = lastIntStatus & (1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT);
+    uint16_t fifoC = getFIFOCount();
+    uint32_t now = micros();
+    if (overflow) fifoStats.overflows++;
+    if (overflow || fifoC == MPU6050_FIFO_SIZE) {
+        countOverwrittenPackets(length, now);
+        uint16_t skip = fifoC % length + length;
+        if (skip > fifoC) skip = fifoC;
+        if (!skipFIFOBytes(skip, micros())) {
+            // left part way through a packet, start over like GetCurrentFIFOPacket()
+            resetFIFO();
+            fifoStats.resets++;
+            fifoStats.dropped += (fifoC + length - 1) / length;
+            return 0;
+        }
+        fifoStats.resyncs++;
+        fifoStats.dropped += (skip + length - 1) / length;
+        fifoC -= skip;
+    }
+    // a partial packet at the end is still being written
+    uint16_t packets = fifoC / length;
+    if (packets > maxPackets) packets = maxPackets;
+    if (packets) {
+        getFIFOBytes(data, packets * length);
+        fifoStats.delivered += packets;
+    }
+    fifoCountTime = now;
+    fifoLeft = fifoC - packets * length;
+    return packets;
 }
 
-
 /** Write byte to FIFO buffer.
  * @see getFIFOByte()
  * @see MPU6050_RA_FIFO_R_W
@@ -2835,7 +3015,7 @@ uint8_t MPU6050_Base::getDeviceID() {
  * @see MPU6050_WHO_AM_I_LENGTH
  */
 void MPU6050_Base::setDeviceID(uint8_t id) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, id, wireObj);
+    I2CdevRegisterField<MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH>::write(devAddr, id, wireObj);
 }
 
 // ======== UNDOCUMENTED/DMP REGISTERS/METHODS ========
@@ -2854,7 +3034,7 @@ int8_t MPU6050_Base::getXGyroOffsetTC() {
     return buffer[0];
 }
 void MPU6050_Base::setXGyroOffsetTC(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset, wireObj);
+    I2CdevRegisterField<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::write(devAddr, offset, wireObj);
 }
 
 // YG_OFFS_TC register
@@ -2864,7 +3044,7 @@ int8_t MPU6050_Base::getYGyroOffsetTC() {
     return buffer[0];
 }
 void MPU6050_Base::setYGyroOffsetTC(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset, wireObj);
+    I2CdevRegisterField<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::write(devAddr, offset, wireObj);
 }
 
 // ZG_OFFS_TC register
@@ -2874,7 +3054,7 @@ int8_t MPU6050_Base::getZGyroOffsetTC() {
     return buffer[0];
 }
 void MPU6050_Base::setZGyroOffsetTC(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset, wireObj);
+    I2CdevRegisterField<MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::write(devAddr, offset, wireObj);
 }
 
 // X_FINE_GAIN register
@@ -4,6 +4,12 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//  2026/10/19 - estimate packets overwritten in FIFO overflows, add getLastIntStatus()
+//  2026/10/19 - count packets that fail validation in MPU6050FIFOStats
+//  2026/10/19 - add FIFO packet accounting, overflow resync and getFIFOPackets()
+//  2026/10/19 - getFIFOBytes() takes a 16-bit length
+//  2026/10/19 - build on non-Arduino platforms through the port's I2Cdev.h and I2CdevPort.h
+//  2026/10/19 - add getSamplePeriodMicroseconds()
 //  2021/09/27 - split implementations out of header files, finally
 //     ... - ongoing debug release
 
@@ -39,6 +45,10 @@ THE SOFTWARE.
 #define _MPU6050_H_
 
 #include "I2Cdev.h"
+#ifndef ARDUINO
+    // millis()/micros()/delay(), PROGMEM and Serial for platforms without the Arduino core
+    #include "I2CdevPort.h"
+#endif
 #include "helper_3dmath.h"
 
 // supporting link:  http://forum.arduino.cc/index.php?&topic=143444.msg1079517#msg1079517
@@ -60,6 +70,7 @@ THE SOFTWARE.
 #define MPU6050_ADDRESS_AD0_LOW     0x68 // address pin low (GND), default for InvenSense evaluation board
 #define MPU6050_ADDRESS_AD0_HIGH    0x69 // address pin high (VCC)
 #define MPU6050_DEFAULT_ADDRESS     MPU6050_ADDRESS_AD0_LOW
+#define MPU6050_MAX_CLOCK_HZ        400000 // fast mode
 
 #define MPU6050_RA_XG_OFFS_TC       0x00 //[7] PWR_MODE, [6:1] XG_OFFS_TC, [0] OTP_BNK_VLD
 #define MPU6050_RA_YG_OFFS_TC       0x01 //[7] PWR_MODE, [6:1] YG_OFFS_TC, [0] OTP_BNK_VLD
@@ -436,6 +447,22 @@ THE SOFTWARE.
 #define MPU6050_DMP_MEMORY_CHUNK_SIZE   16
 
 #define MPU6050_FIFO_DEFAULT_TIMEOUT 11000
+#define MPU6050_FIFO_SIZE            1024
+
+/** FIFO packet accounting of GetCurrentFIFOPacket() and getFIFOPackets().
+ * Packets the chip overwrites when the FIFO overflows never reach the host;
+ * they are estimated from the time since the previous FIFO read and the
+ * packet period, so dropped is approximate after an overflow.
+ */
+struct MPU6050FIFOStats {
+    uint32_t delivered; // packets returned to the caller
+    uint32_t dropped;   // packets discarded by the driver (stale, partial or flushed by a reset)
+    uint32_t overflows; // FIFO_OFLOW interrupts seen
+    uint32_t resyncs;   // realignments to a packet boundary by skipping a partial packet
+    uint32_t resets;    // FIFO resets because skipping would have overrun the FIFO timeout
+    uint32_t invalid;   // packets rejected by a packet validator (e.g. dmpValidatePacket()), also in dropped
+    uint32_t overwritten; // estimated packets the chip overwrote during overflows, also in dropped
+};
 
 class MPU6050_Base {
     public:
@@ -457,6 +484,7 @@ class MPU6050_Base {
         void setExternalFrameSync(uint8_t sync);
         uint8_t getDLPFMode();
         void setDLPFMode(uint8_t bandwidth);
+        uint32_t getSamplePeriodMicroseconds();
 
         // GYRO_CONFIG register
         uint8_t getFullScaleGyroRange();
@@ -719,10 +747,14 @@ class MPU6050_Base {
         // FIFO_R_W register
         uint8_t getFIFOByte();
 		int8_t GetCurrentFIFOPacket(uint8_t *data, uint8_t length);
+        uint16_t getFIFOPackets(uint8_t *data, uint16_t maxPackets, uint8_t length);
         void setFIFOByte(uint8_t data);
-        void getFIFOBytes(uint8_t *data, uint8_t length);
+        void getFIFOBytes(uint8_t *data, uint16_t length);
         void setFIFOTimeout(uint32_t fifoTimeout);
         uint32_t getFIFOTimeout();
+        void getFIFOStats(MPU6050FIFOStats *stats);
+        void resetFIFOStats();
+        uint8_t getLastIntStatus();
 
         // WHO_AM_I register
         uint8_t getDeviceID();
@@ -839,6 +871,14 @@ class MPU6050_Base {
         void *wireObj;
         uint8_t buffer[14];
         uint32_t fifoTimeout = MPU6050_FIFO_DEFAULT_TIMEOUT;
+        MPU6050FIFOStats fifoStats = { 0, 0, 0, 0, 0, 0, 0 };
+        uint8_t lastIntStatus = 0;
+        uint32_t fifoPacketPeriod = 0;      // microseconds, 0 for one packet per sample
+        uint32_t fifoCountTime = 0;         // micros() when fifoLeft was known
+        uint16_t fifoLeft = 0xFFFF;         // bytes left in the FIFO then, 0xFFFF if unknown
+
+        bool skipFIFOBytes(uint16_t length, uint32_t startTime);
+        void countOverwrittenPackets(uint8_t length, uint32_t now);
     
     private:
         int16_t offsets[6];
@@ -4,6 +4,9 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//  2026/10/19 - register setup runs from I2CdevConfig tables: reset is polled, neighbouring registers burst written
+//  2026/10/19 - set EXT_SYNC_SET and DLPF_CFG with one CONFIG register update
+//  2026/10/19 - implement dmpSetFIFORate()/dmpGetFIFORate(), the output divisor is no longer fixed at build time
 //  2021/09/27 - split implementations out of header files, finally
 //  2019/07/08 - merged all DMP Firmware configuration items into the dmpMemory array
 //             - Simplified dmpInitialize() to accomidate the dmpmemory array alterations
@@ -36,6 +39,7 @@ THE SOFTWARE.
 #define MPU6050_INCLUDE_DMP_MOTIONAPPS20
 
 #include "MPU6050_6Axis_MotionApps20.h"
+#include "I2CdevConfig.h"
 
 // Tom Carpenter's conditional PROGMEM code
 // http://forum.arduino.cc/index.php?topic=129407.0
@@ -268,21 +272,54 @@ static const unsigned char dmpMemory[MPU6050_DMP_CODE_SIZE] PROGMEM = {
 #define MPU6050_DMP_FIFO_RATE_DIVISOR 0x01 // The New instance of the Firmware has this as the default
 #endif
 
+#define MPU6050_DMP_SAMPLE_RATE     200     // Hz, SMPLRT_DIV as set by dmpInitialize()
+#define MPU6050_DMP_FIFO_RATE_BANK  0x02    // D_0_22: 16-bit big-endian FIFO output divisor
+#define MPU6050_DMP_FIFO_RATE_ADDR  0x16
+
+// register setup before the DMP code is loaded
+static const I2CdevConfigStep dmpResetProfile[] PROGMEM = {
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_PWR_MGMT_1, 0x80),           // DEVICE_RESET
+	I2CDEV_CONFIG_POLL(MPU6050_RA_PWR_MGMT_1, 0x80, 0x00, 100), // the bit clears when the reset is done
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_PWR_MGMT_1, 0x00),           // out of sleep mode
+	I2CDEV_CONFIG_END
+};
+
+static const I2CdevConfigStep dmpSetupProfile[] PROGMEM = {
+	// setup weird slave stuff (?)
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_I2C_SLV0_ADDR, 0x7F),
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_USER_CTRL, 0x00),            // I2C master mode off
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_I2C_SLV0_ADDR, 0x68),        // self
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_USER_CTRL, 0x02),            // I2C_MST_RESET
+	I2CDEV_CONFIG_DELAY(20),
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_PWR_MGMT_1, MPU6050_CLOCK_PLL_ZGYRO),
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_INT_ENABLE, (1<<MPU6050_INTERRUPT_FIFO_OFLOW_BIT)|(1<<MPU6050_INTERRUPT_DMP_INT_BIT)),
+	// one burst for SMPLRT_DIV..GYRO_CONFIG
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_SMPLRT_DIV, 4),              // 1khz / (1 + 4) = 200 Hz
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_CONFIG, (MPU6050_EXT_SYNC_TEMP_OUT_L << 3) | MPU6050_DLPF_BW_42),
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_GYRO_CONFIG, MPU6050_GYRO_FS_2000 << 3), // +/- 2000 deg/sec
+	I2CDEV_CONFIG_END
+};
+
+// register setup after the DMP code is loaded
+static const I2CdevConfigStep dmpStartProfile[] PROGMEM = {
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_DMP_CFG_1, 0x03),            // DMP start address
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_DMP_CFG_2, 0x00),
+	I2CDEV_CONFIG_MODIFY(MPU6050_RA_XG_OFFS_TC, 0x01, 0x00),    // clear OTP bank valid, keep the gyro trim
+	// one burst for MOT_THR..ZRMOT_DUR
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_MOT_THR, 2),
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_MOT_DUR, 80),
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_ZRMOT_THR, 156),
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_ZRMOT_DUR, 0),
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_USER_CTRL, 0x48),            // FIFO_EN, DMP_RESET, DMP left disabled (you turn it on later)
+	I2CDEV_CONFIG_WRITE(MPU6050_RA_USER_CTRL, 0x44),            // FIFO_EN, FIFO_RESET
+	I2CDEV_CONFIG_END
+};
+
 // I Simplified this:
 uint8_t MPU6050_6Axis_MotionApps20::dmpInitialize() {
 	// reset device
 	DEBUG_PRINTLN(F("\n\nResetting MPU6050..."));
-	reset();
-	delay(30); // wait after reset
-
-	// enable sleep mode and wake cycle
-	/*Serial.println(F("Enabling sleep mode..."));
-	setSleepEnabled(true);
-	Serial.println(F("Enabling wake cycle..."));
-	setWakeCycleEnabled(true);*/
-
-	// disable sleep mode
-	setSleepEnabled(false);
+	if (I2CdevConfig::apply(devAddr, dmpResetProfile, wireObj)) return 1; // no answer
 
 	// get MPU hardware revision
 	setMemoryBank(0x10, true, true);
@@ -298,33 +335,8 @@ uint8_t MPU6050_6Axis_MotionApps20::dmpInitialize() {
 	DEBUG_PRINT(F("OTP bank is "));
 	DEBUG_PRINTLN(getOTPBankValid() ? F("valid!") : F("invalid!"));
 
-	// setup weird slave stuff (?)
-	DEBUG_PRINTLN(F("Setting slave 0 address to 0x7F..."));
-	setSlaveAddress(0, 0x7F);
-	DEBUG_PRINTLN(F("Disabling I2C Master mode..."));
-	setI2CMasterModeEnabled(false);
-	DEBUG_PRINTLN(F("Setting slave 0 address to 0x68 (self)..."));
-	setSlaveAddress(0, 0x68);
-	DEBUG_PRINTLN(F("Resetting I2C Master control..."));
-	resetI2CMaster();
-	delay(20);
-	DEBUG_PRINTLN(F("Setting clock source to Z Gyro..."));
-	setClockSource(MPU6050_CLOCK_PLL_ZGYRO);
-
-	DEBUG_PRINTLN(F("Setting DMP and FIFO_OFLOW interrupts enabled..."));
-	setIntEnabled(1<<MPU6050_INTERRUPT_FIFO_OFLOW_BIT|1<<MPU6050_INTERRUPT_DMP_INT_BIT);
-
-	DEBUG_PRINTLN(F("Setting sample rate to 200Hz..."));
-	setRate(4); // 1khz / (1 + 4) = 200 Hz
-
-	DEBUG_PRINTLN(F("Setting external frame sync to TEMP_OUT_L[0]..."));
-	setExternalFrameSync(MPU6050_EXT_SYNC_TEMP_OUT_L);
-
-	DEBUG_PRINTLN(F("Setting DLPF bandwidth to 42Hz..."));
-	setDLPFMode(MPU6050_DLPF_BW_42);
-
-	DEBUG_PRINTLN(F("Setting gyro sensitivity to +/- 2000 deg/sec..."));
-	setFullScaleGyroRange(MPU6050_GYRO_FS_2000);
+	DEBUG_PRINTLN(F("Setting clock source, interrupts, 200Hz sample rate, 42Hz DLPF and +/- 2000 deg/sec..."));
+	if (I2CdevConfig::apply(devAddr, dmpSetupProfile, wireObj)) return 1;
 
 	// load DMP code into memory banks
 	DEBUG_PRINT(F("Writing DMP code to MPU memory banks ("));
@@ -337,41 +349,15 @@ uint8_t MPU6050_6Axis_MotionApps20::dmpInitialize() {
 	unsigned char dmpUpdate[] = {0x00, MPU6050_DMP_FIFO_RATE_DIVISOR};
 	writeMemoryBlock(dmpUpdate, 0x02, 0x02, 0x16); // Lets write the dmpUpdate data to the Firmware image, we have 2 bytes to write in bank 0x02 with the Offset 0x16
 
-	//write start address MSB into register
-	setDMPConfig1(0x03);
-	//write start address LSB into register
-	setDMPConfig2(0x00);
-
-	DEBUG_PRINTLN(F("Clearing OTP Bank flag..."));
-	setOTPBankValid(false);
-
-	DEBUG_PRINTLN(F("Setting motion detection threshold to 2..."));
-	setMotionDetectionThreshold(2);
-
-	DEBUG_PRINTLN(F("Setting zero-motion detection threshold to 156..."));
-	setZeroMotionDetectionThreshold(156);
-
-	DEBUG_PRINTLN(F("Setting motion detection duration to 80..."));
-	setMotionDetectionDuration(80);
-
-	DEBUG_PRINTLN(F("Setting zero-motion detection duration to 0..."));
-	setZeroMotionDetectionDuration(0);
-	DEBUG_PRINTLN(F("Enabling FIFO..."));
-	setFIFOEnabled(true);
-
-	DEBUG_PRINTLN(F("Resetting DMP..."));
-	resetDMP();
-
-	DEBUG_PRINTLN(F("DMP is good to go! Finally."));
-
-	DEBUG_PRINTLN(F("Disabling DMP (you turn it on later)..."));
-	setDMPEnabled(false);
+	DEBUG_PRINTLN(F("Setting DMP start address, motion thresholds, enabling and resetting FIFO..."));
+	if (I2CdevConfig::apply(devAddr, dmpStartProfile, wireObj)) return 1;
 
 	DEBUG_PRINTLN(F("Setting up internal 42-byte (default) DMP packet buffer..."));
 	dmpPacketSize = 42;
+	dmpFIFORateDivisor = MPU6050_DMP_FIFO_RATE_DIVISOR;
+	fifoPacketPeriod = 1000000UL / MPU6050_DMP_SAMPLE_RATE * (1 + dmpFIFORateDivisor);
 
-	DEBUG_PRINTLN(F("Resetting FIFO and clearing INT status one last time..."));
-	resetFIFO();
+	DEBUG_PRINTLN(F("Clearing INT status one last time..."));
 	getIntStatus();
 
 	return 0; // success
@@ -382,10 +368,48 @@ bool MPU6050_6Axis_MotionApps20::dmpPacketAvailable() {
     return getFIFOCount() >= dmpGetFIFOPacketSize();
 }
 
-// uint8_t MPU6050_6Axis_MotionApps20::dmpSetFIFORate(uint8_t fifoRate);
-// uint8_t MPU6050_6Axis_MotionApps20::dmpGetFIFORate();
-// uint8_t MPU6050_6Axis_MotionApps20::dmpGetSampleStepSizeMS();
-// uint8_t MPU6050_6Axis_MotionApps20::dmpGetSampleFrequency();
+/** Set the rate at which the DMP writes packets to the FIFO.
+ * The DMP computes a result at every sample (200 Hz) and queues every
+ * (1 + divisor)th one, so the rate used is the nearest one at or above the
+ * request that 200 Hz divides into (e.g. 60 Hz gives 66 Hz). Lower rates
+ * cut FIFO reads and bus load, higher ones cut latency. Takes effect
+ * immediately; the DMP can stay enabled.
+ * @param fifoRate Packets per second, 1-200
+ * @return 0 on success, 1 if out of range, 2 if the DMP memory write failed
+ * @see dmpGetFIFORate()
+ */
+uint8_t MPU6050_6Axis_MotionApps20::dmpSetFIFORate(uint8_t fifoRate) {
+    if (fifoRate == 0 || fifoRate > MPU6050_DMP_SAMPLE_RATE) return 1;
+    uint8_t divisor = MPU6050_DMP_SAMPLE_RATE / fifoRate - 1;
+    uint8_t data[2] = { 0x00, divisor };
+    if (!writeMemoryBlock(data, 2, MPU6050_DMP_FIFO_RATE_BANK, MPU6050_DMP_FIFO_RATE_ADDR)) return 2;
+    dmpFIFORateDivisor = divisor;
+    fifoPacketPeriod = 1000000UL / MPU6050_DMP_SAMPLE_RATE * (1 + divisor);
+    return 0;
+}
+
+/** Get the rate at which the DMP writes packets to the FIFO.
+ * @return Packets per second
+ * @see dmpSetFIFORate()
+ */
+uint8_t MPU6050_6Axis_MotionApps20::dmpGetFIFORate() {
+    return MPU6050_DMP_SAMPLE_RATE / (1 + dmpFIFORateDivisor);
+}
+
+/** Get the time between two FIFO packets.
+ * @return Packet period in milliseconds
+ */
+uint16_t MPU6050_6Axis_MotionApps20::dmpGetSampleStepSizeMS() {
+    return (1000 / MPU6050_DMP_SAMPLE_RATE) * (1 + dmpFIFORateDivisor);
+}
+
+/** Get the rate at which the DMP itself runs, whatever the FIFO rate.
+ * @return Samples per second
+ */
+uint8_t MPU6050_6Axis_MotionApps20::dmpGetSampleFrequency() {
+    return MPU6050_DMP_SAMPLE_RATE;
+}
+
 // int32_t MPU6050_6Axis_MotionApps20::dmpDecodeTemperature(int8_t tempReg);
 
 //uint8_t MPU6050_6Axis_MotionApps20::dmpRegisterFIFORateProcess(inv_obj_func func, int16_t priority);
@@ -460,6 +484,11 @@ uint8_t MPU6050_6Axis_MotionApps20::dmpGetQuaternion(Quaternion *q, const uint8_
     }
     return status; // int16 return value, indicates error if this line is reached
 }
+uint8_t MPU6050_6Axis_MotionApps20::dmpGetQuaternion(QuaternionArray *q, const uint8_t* packets, uint16_t length) {
+    // decode "length" consecutive FIFO packets (e.g. one multi-packet FIFO read) into SoA form
+    q -> setFromPackets(packets, dmpPacketSize, length);
+    return 0;
+}
 // uint8_t MPU6050_6Axis_MotionApps20::dmpGet6AxisQuaternion(long *data, const uint8_t* packet);
 // uint8_t MPU6050_6Axis_MotionApps20::dmpGetRelativeQuaternion(long *data, const uint8_t* packet);
 uint8_t MPU6050_6Axis_MotionApps20::dmpGetGyro(int32_t *data, const uint8_t* packet) {
@@ -503,6 +532,10 @@ uint8_t MPU6050_6Axis_MotionApps20::dmpGetLinearAccelInWorld(VectorInt16 *v, Vec
     v -> rotate(q);
     return 0;
 }
+uint8_t MPU6050_6Axis_MotionApps20::dmpGetLinearAccelInWorld(VectorInt16Array *v, VectorInt16Array *vReal, QuaternionArray *q, uint16_t length) {
+    v -> rotate(vReal, q, length);
+    return 0;
+}
 // uint8_t MPU6050_6Axis_MotionApps20::dmpGetGyroAndAccelSensor(long *data, const uint8_t* packet);
 // uint8_t MPU6050_6Axis_MotionApps20::dmpGetGyroSensor(long *data, const uint8_t* packet);
 // uint8_t MPU6050_6Axis_MotionApps20::dmpGetControlData(long *data, const uint8_t* packet);
@@ -525,6 +558,11 @@ uint8_t MPU6050_6Axis_MotionApps20::dmpGetGravity(VectorFloat *v, Quaternion *q)
     v -> z = q -> w*q -> w - q -> x*q -> x - q -> y*q -> y + q -> z*q -> z;
     return 0;
 }
+
+uint8_t MPU6050_6Axis_MotionApps20::dmpGetGravity(VectorFloatArray *v, QuaternionArray *q, uint16_t length) {
+    v -> setGravity(q, length);
+    return 0;
+}
 // uint8_t MPU6050_6Axis_MotionApps20::dmpGetUnquantizedAccel(long *data, const uint8_t* packet);
 // uint8_t MPU6050_6Axis_MotionApps20::dmpGetQuantizedAccel(long *data, const uint8_t* packet);
 // uint8_t MPU6050_6Axis_MotionApps20::dmpGetExternalSensorData(long *data, int size, const uint8_t* packet);
@@ -566,6 +604,16 @@ uint8_t MPU6050_6Axis_MotionApps20::dmpGetYawPitchRoll(float *data, Quaternion *
 }
 #endif
 
+uint8_t MPU6050_6Axis_MotionApps20::dmpGetYawPitchRoll(VectorFloatArray *data, QuaternionArray *q, VectorFloatArray *gravity, uint16_t length) {
+    // yaw/pitch/roll end up in data -> x/y/z respectively (same order as the float[3] variant)
+#ifdef USE_OLD_DMPGETYAWPITCHROLL
+    data -> setYawPitchRollOld(q, gravity, length);
+#else
+    data -> setYawPitchRoll(q, gravity, length);
+#endif
+    return 0;
+}
+
 // uint8_t MPU6050_6Axis_MotionApps20::dmpGetAccelFloat(float *data, const uint8_t* packet);
 // uint8_t MPU6050_6Axis_MotionApps20::dmpGetQuaternionFloat(float *data, const uint8_t* packet);
 
@@ -4,6 +4,9 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//  2026/10/19 - validate packets and realign the FIFO by skipping bytes instead of resetting it
+//  2026/10/19 - implement dmpSetFIFORate()/dmpGetFIFORate(), the output divisor is no longer fixed at build time
+//  2026/10/19 - add DMP output feature selection (dmpSetFeatures); accessors follow the packet layout
 //  2021/09/27 - split implementations out of header files, finally
 //  2019/07/10 - I incorporated DMP Firmware Version 6.12 Latest as of today with many features and bug fixes.
 //             - MPU6050 Registers have not changed just the DMP Image so that full backwards compatibility is present
@@ -123,10 +126,34 @@ THE SOFTWARE.
  | [QUAT W][      ][QUAT X][      ][QUAT Y][      ][QUAT Z][      ] |
  |   0   1   2   3   4   5   6   7   8   9  10  11  12  13  14  15  |
  |                                                                  |
- | [GYRO X][GYRO Y][GYRO Z][ACC X ][ACC Y ][ACC Z ]					|
- |  16  17  18  19  20  21  22  23  24  25  26  27					|
+ | [ACC X ][ACC Y ][ACC Z ][GYRO X][GYRO Y][GYRO Z]                 |
+ |  16  17  18  19  20  21  22  23  24  25  26  27                  |
+ |                                                                  |
+ | dmpSetFeatures() drops the fields that are not selected and may  |
+ | add a 4-byte gesture word at the end; the rest keep this order.  |
  * ================================================================ */
 
+// DMP memory locations patched by dmpSetFeatures() (from the eMPL motion driver for this image)
+#define MPU6050_DMP_CFG_LP_QUAT             2712
+#define MPU6050_DMP_CFG_8                   2718    // 6-axis quaternion
+#define MPU6050_DMP_CFG_GYRO_RAW_DATA       2722
+#define MPU6050_DMP_CFG_15                  2727    // raw sensor data to FIFO
+#define MPU6050_DMP_CFG_27                  2742    // gesture word to FIFO
+#define MPU6050_DMP_CFG_20                  2224    // tap engine
+#define MPU6050_DMP_CFG_ANDROID_ORIENT_INT  1853
+#define MPU6050_DMP_CFG_MOTION_BIAS         1208
+
+// FIFO packet fields in DMP output order: features that put each one in the packet, and its size
+static const struct {
+    uint16_t features;
+    uint8_t size;
+} dmpPacketFields[MPU6050_DMP_FIELD_COUNT] = {
+    { MPU6050_DMP_FEATURE_LP_QUAT | MPU6050_DMP_FEATURE_6X_LP_QUAT, 16 },
+    { MPU6050_DMP_FEATURE_SEND_RAW_ACCEL, 6 },
+    { MPU6050_DMP_FEATURE_SEND_RAW_GYRO | MPU6050_DMP_FEATURE_SEND_CAL_GYRO, 6 },
+    { MPU6050_DMP_FEATURE_TAP | MPU6050_DMP_FEATURE_ANDROID_ORIENT, 4 },
+};
+
 // this block of memory gets written to the MPU on start-up, and it seems
 // to be volatile memory, so it has to be done each time (it only takes ~1
 // second though)
@@ -339,11 +366,16 @@ const unsigned char dmpMemory[MPU6050_DMP_CODE_SIZE] PROGMEM = {
 0xA6, 0xD9, 0x00, 0xD8, 0xF1, 0xFF,
 };
 
-// this divisor is pre configured into the above image and can't be modified at this time.
+// the above image has 0x01 (100 Hz) here; dmpInitialize() writes any other build-time
+// divisor over it, dmpSetFIFORate() changes it at run time.
 #ifndef MPU6050_DMP_FIFO_RATE_DIVISOR 
 #define MPU6050_DMP_FIFO_RATE_DIVISOR 0x01 // The New instance of the Firmware has this as the default 
 #endif
 
+#define MPU6050_DMP_SAMPLE_RATE     200     // Hz, SMPLRT_DIV as set by dmpInitialize()
+#define MPU6050_DMP_FIFO_RATE_BANK  0x02    // D_0_22: 16-bit big-endian FIFO output divisor
+#define MPU6050_DMP_FIFO_RATE_ADDR  0x16
+
 // this is the most basic initialization I can create. with the intent that we access the register bytes as few times as needed to get the job done.
 // for detailed descriptins of all registers and there purpose google "MPU-6000/MPU-6050 Register Map and Descriptions"
 uint8_t MPU6050::dmpInitialize() { // Lets get it over with fast Write everything once and set it up necely
@@ -363,6 +395,10 @@ uint8_t MPU6050::dmpInitialize() { // Lets get it over with fast Write everythin
 	I2Cdev::writeBytes(devAddr,0x19, 1, &(val = 0x04), wireObj); // 0000 0100 SMPLRT_DIV: Divides the internal sample rate 400Hz ( Sample Rate = Gyroscope Output Rate / (1 + SMPLRT_DIV))
 	I2Cdev::writeBytes(devAddr,0x1A, 1, &(val = 0x01), wireObj); // 0000 0001 CONFIG: Digital Low Pass Filter (DLPF) Configuration 188HZ  //Im betting this will be the beat
 	if (!writeProgMemoryBlock(dmpMemory, MPU6050_DMP_CODE_SIZE)) return 1; // Loads the DMP image into the MPU6050 Memory // Should Never Fail
+#if MPU6050_DMP_FIFO_RATE_DIVISOR != 0x01
+	uint8_t divisor[2] = { 0x00, MPU6050_DMP_FIFO_RATE_DIVISOR };
+	if (!writeMemoryBlock(divisor, 2, MPU6050_DMP_FIFO_RATE_BANK, MPU6050_DMP_FIFO_RATE_ADDR)) return 1; // D_0_22, replaces the image's 0x01
+#endif
 	I2Cdev::writeWords(devAddr, 0x70, 1, &(ival = 0x0400), wireObj); // DMP Program Start Address
 	I2Cdev::writeBytes(devAddr,0x1B, 1, &(val = 0x18), wireObj); // 0001 1000 GYRO_CONFIG: 3 = +2000 Deg/sec
 	I2Cdev::writeBytes(devAddr,0x6A, 1, &(val = 0xC0), wireObj); // 1100 1100 USER_CTRL: Enable Fifo and Reset Fifo
@@ -370,23 +406,223 @@ uint8_t MPU6050::dmpInitialize() { // Lets get it over with fast Write everythin
 	I2Cdev::writeBit(devAddr,0x6A, 2, 1, wireObj);      // Reset FIFO one last time just for kicks. (MPUi2cWrite reads 0x6A first and only alters 1 bit and then saves the byte)
 
   setDMPEnabled(false); // disable DMP for compatibility with the MPU6050 library
-/*
-    dmpPacketSize += 16;//DMP_FEATURE_6X_LP_QUAT
-    dmpPacketSize += 6;//DMP_FEATURE_SEND_RAW_ACCEL
-    dmpPacketSize += 6;//DMP_FEATURE_SEND_RAW_GYRO
-*/
-	dmpPacketSize = 28;
+	dmpFeatures = MPU6050_DMP_FEATURE_DEFAULT; // as captured in the image, 28-byte packets
+	dmpUpdateLayout();
+	dmpFIFORateDivisor = MPU6050_DMP_FIFO_RATE_DIVISOR; // D_0_22
+	fifoPacketPeriod = 1000000UL / MPU6050_DMP_SAMPLE_RATE * (1 + dmpFIFORateDivisor);
 	return 0;
 }
 
+/** Choose what the DMP writes to the FIFO for each sample.
+ * Patches the DMP configuration the same way the InvenSense eMPL driver's
+ * dmp_enable_feature() does, resets the FIFO and recomputes the packet
+ * layout used by the dmpGet*() accessors. Dropping fields shortens every
+ * FIFO packet: a quaternion-only packet is 16 bytes instead of the default
+ * 28. Call after dmpInitialize(), with the DMP disabled.
+ * Tap detection uses the thresholds preloaded in the DMP image.
+ * Without a quaternion, dmpValidatePacket() only has the limits from
+ * dmpSetPacketLimits() to go on: with the default (0, 0) it accepts every
+ * packet, so dmpGetFIFOPackets() cannot detect or repair a misaligned FIFO.
+ * @param features OR of MPU6050_DMP_FEATURE_* values; at most one of the two
+ *        quaternions and one of the two gyro outputs
+ * @return 0 on success, 1 for an invalid combination, 2 if a DMP memory write failed
+ * @see dmpGetFIFOPacketSize()
+ */
+uint8_t MPU6050::dmpSetFeatures(uint16_t features) {
+    const uint16_t quat = MPU6050_DMP_FEATURE_LP_QUAT | MPU6050_DMP_FEATURE_6X_LP_QUAT;
+    const uint16_t gyro = MPU6050_DMP_FEATURE_SEND_RAW_GYRO | MPU6050_DMP_FEATURE_SEND_CAL_GYRO;
+    const uint16_t gesture = MPU6050_DMP_FEATURE_TAP | MPU6050_DMP_FEATURE_ANDROID_ORIENT;
+    if ((features & quat) == quat || (features & gyro) == gyro) return 1;
+    if (!(features & (quat | gyro | gesture | MPU6050_DMP_FEATURE_SEND_RAW_ACCEL))) return 1;
+
+    uint8_t cfg[10];
+    bool ok = true;
+
+    // raw sensor data
+    cfg[0] = 0xA3;
+    if (features & MPU6050_DMP_FEATURE_SEND_RAW_ACCEL) {
+        cfg[1] = 0xC0; cfg[2] = 0xC8; cfg[3] = 0xC2;
+    } else {
+        cfg[1] = 0xA3; cfg[2] = 0xA3; cfg[3] = 0xA3;
+    }
+    if (features & gyro) {
+        cfg[4] = 0xC4; cfg[5] = 0xCC; cfg[6] = 0xC6;
+    } else {
+        cfg[4] = 0xA3; cfg[5] = 0xA3; cfg[6] = 0xA3;
+    }
+    cfg[7] = 0xA3; cfg[8] = 0xA3; cfg[9] = 0xA3;
+    ok &= writeMemoryBlock(cfg, 10, MPU6050_DMP_CFG_15 >> 8, MPU6050_DMP_CFG_15 & 0xFF);
+
+    // gesture word
+    cfg[0] = (features & gesture) ? 0x20 : 0xD8;
+    ok &= writeMemoryBlock(cfg, 1, MPU6050_DMP_CFG_27 >> 8, MPU6050_DMP_CFG_27 & 0xFF);
+    cfg[0] = (features & MPU6050_DMP_FEATURE_TAP) ? 0xF8 : 0xD8;
+    ok &= writeMemoryBlock(cfg, 1, MPU6050_DMP_CFG_20 >> 8, MPU6050_DMP_CFG_20 & 0xFF);
+    cfg[0] = (features & MPU6050_DMP_FEATURE_ANDROID_ORIENT) ? 0xD9 : 0xD8;
+    ok &= writeMemoryBlock(cfg, 1, MPU6050_DMP_CFG_ANDROID_ORIENT_INT >> 8, MPU6050_DMP_CFG_ANDROID_ORIENT_INT & 0xFF);
+
+    // gyro bias calibration
+    static const uint8_t motionBiasOn[9] = { 0xB8, 0xAA, 0xB3, 0x8D, 0xB4, 0x98, 0x0D, 0x35, 0x5D };
+    static const uint8_t motionBiasOff[9] = { 0xB8, 0xAA, 0xAA, 0xAA, 0xB0, 0x88, 0xC3, 0xC5, 0xC7 };
+    ok &= writeMemoryBlock((features & MPU6050_DMP_FEATURE_GYRO_CAL) ? motionBiasOn : motionBiasOff, 9,
+        MPU6050_DMP_CFG_MOTION_BIAS >> 8, MPU6050_DMP_CFG_MOTION_BIAS & 0xFF);
+
+    // calibrated or raw gyro
+    if (features & gyro) {
+        if (features & MPU6050_DMP_FEATURE_SEND_CAL_GYRO) {
+            cfg[0] = 0xB2; cfg[1] = 0x8B; cfg[2] = 0xB6; cfg[3] = 0x9B;
+        } else {
+            cfg[0] = 0xB0; cfg[1] = 0x80; cfg[2] = 0xB4; cfg[3] = 0x90;
+        }
+        ok &= writeMemoryBlock(cfg, 4, MPU6050_DMP_CFG_GYRO_RAW_DATA >> 8, MPU6050_DMP_CFG_GYRO_RAW_DATA & 0xFF);
+    }
+
+    // quaternions
+    if (features & MPU6050_DMP_FEATURE_LP_QUAT) {
+        cfg[0] = 0xC0; cfg[1] = 0xC2; cfg[2] = 0xC4; cfg[3] = 0xC6;
+    } else {
+        cfg[0] = 0x8B; cfg[1] = 0x8B; cfg[2] = 0x8B; cfg[3] = 0x8B;
+    }
+    ok &= writeMemoryBlock(cfg, 4, MPU6050_DMP_CFG_LP_QUAT >> 8, MPU6050_DMP_CFG_LP_QUAT & 0xFF);
+    if (features & MPU6050_DMP_FEATURE_6X_LP_QUAT) {
+        cfg[0] = 0x20; cfg[1] = 0x28; cfg[2] = 0x30; cfg[3] = 0x38;
+    } else {
+        cfg[0] = 0xA3; cfg[1] = 0xA3; cfg[2] = 0xA3; cfg[3] = 0xA3;
+    }
+    ok &= writeMemoryBlock(cfg, 4, MPU6050_DMP_CFG_8 >> 8, MPU6050_DMP_CFG_8 & 0xFF);
+
+    resetFIFO();
+    if (!ok) return 2;
+    dmpFeatures = features;
+    dmpUpdateLayout();
+    return 0;
+}
+
+/** Get the DMP output features currently selected.
+ * @return OR of MPU6050_DMP_FEATURE_* values
+ * @see dmpSetFeatures()
+ */
+uint16_t MPU6050::dmpGetFeatures() {
+    return dmpFeatures;
+}
+
+/** Get where a field sits in the FIFO packets of the current layout.
+ * @param field MPU6050_DMP_FIELD_* value
+ * @return Byte offset into the packet, or -1 if the field is not sent
+ */
+int8_t MPU6050::dmpGetFieldOffset(uint8_t field) {
+    return field < MPU6050_DMP_FIELD_COUNT ? dmpFieldOffset[field] : -1;
+}
+
+/** Get the tap event of a packet.
+ * Needs MPU6050_DMP_FEATURE_TAP.
+ * @param direction Receives the tap axis and sign (1/2 = X+/X-, 3/4 = Y+/Y-, 5/6 = Z+/Z-)
+ * @param count Receives the number of taps (1-8), or 0 if this packet reports none
+ * @param packet Packet to decode, or 0 for the internal buffer
+ * @return 0 on success, 1 if the packet has no gesture word
+ */
+uint8_t MPU6050::dmpGetTap(uint8_t *direction, uint8_t *count, const uint8_t* packet) {
+    const uint8_t *gesture = dmpGetField(MPU6050_DMP_FIELD_GESTURE, packet);
+    if (gesture == 0) return 1;
+    uint8_t tap = gesture[3] & 0x3F;
+    if (gesture[1] & 0x01) {
+        *direction = tap >> 3;
+        *count = (tap % 8) + 1;
+    } else {
+        *direction = 0;
+        *count = 0;
+    }
+    return 0;
+}
+
+/** Get the screen orientation event of a packet.
+ * Needs MPU6050_DMP_FEATURE_ANDROID_ORIENT.
+ * @param orientation Receives 0-3 (portrait, landscape, reverse portrait,
+ *        reverse landscape), or 0xFF if this packet reports no change
+ * @param packet Packet to decode, or 0 for the internal buffer
+ * @return 0 on success, 1 if the packet has no gesture word
+ */
+uint8_t MPU6050::dmpGetOrientation(uint8_t *orientation, const uint8_t* packet) {
+    const uint8_t *gesture = dmpGetField(MPU6050_DMP_FIELD_GESTURE, packet);
+    if (gesture == 0) return 1;
+    *orientation = (gesture[1] & 0x08) ? (gesture[3] & 0xC0) >> 6 : 0xFF;
+    return 0;
+}
+
+/** Locate a field in a packet.
+ * @param field MPU6050_DMP_FIELD_* value
+ * @param packet Packet, or 0 for the internal buffer
+ * @return Pointer to the field's first byte, or 0 if the field is not sent
+ */
+const uint8_t *MPU6050::dmpGetField(uint8_t field, const uint8_t *packet) {
+    if (dmpFieldOffset[field] < 0) return 0;
+    if (packet == 0) packet = dmpPacketBuffer;
+    return packet + dmpFieldOffset[field];
+}
+
+/** Work out the packet size and field offsets from dmpFeatures. */
+void MPU6050::dmpUpdateLayout() {
+    dmpPacketSize = 0;
+    for (uint8_t i = 0; i < MPU6050_DMP_FIELD_COUNT; i++) {
+        if (dmpFeatures & dmpPacketFields[i].features) {
+            dmpFieldOffset[i] = dmpPacketSize;
+            dmpPacketSize += dmpPacketFields[i].size;
+        } else {
+            dmpFieldOffset[i] = -1;
+        }
+    }
+}
+
 bool MPU6050::dmpPacketAvailable() {
     return getFIFOCount() >= dmpGetFIFOPacketSize();
 }
 
-// uint8_t MPU6050::dmpSetFIFORate(uint8_t fifoRate);
-// uint8_t MPU6050::dmpGetFIFORate();
-// uint8_t MPU6050::dmpGetSampleStepSizeMS();
-// uint8_t MPU6050::dmpGetSampleFrequency();
+/** Set the rate at which the DMP writes packets to the FIFO.
+ * The DMP computes a result at every sample (200 Hz) and queues every
+ * (1 + divisor)th one, so the rate used is the nearest one at or above the
+ * request that 200 Hz divides into (e.g. 60 Hz gives 66 Hz). Lower rates
+ * cut FIFO reads and bus load, higher ones cut latency. Takes effect
+ * immediately; the DMP can stay enabled.
+ * With this image the DMP interrupt keeps firing at 200 Hz unless the
+ * gesture word is enabled (MPU6050_DMP_FEATURE_TAP or _ANDROID_ORIENT in
+ * dmpSetFeatures()), so poll for whole packets rather than counting
+ * interrupts.
+ * @param fifoRate Packets per second, 1-200
+ * @return 0 on success, 1 if out of range, 2 if the DMP memory write failed
+ * @see dmpGetFIFORate()
+ */
+uint8_t MPU6050::dmpSetFIFORate(uint8_t fifoRate) {
+    if (fifoRate == 0 || fifoRate > MPU6050_DMP_SAMPLE_RATE) return 1;
+    uint8_t divisor = MPU6050_DMP_SAMPLE_RATE / fifoRate - 1;
+    uint8_t data[2] = { 0x00, divisor };
+    if (!writeMemoryBlock(data, 2, MPU6050_DMP_FIFO_RATE_BANK, MPU6050_DMP_FIFO_RATE_ADDR)) return 2;
+    dmpFIFORateDivisor = divisor;
+    fifoPacketPeriod = 1000000UL / MPU6050_DMP_SAMPLE_RATE * (1 + divisor);
+    return 0;
+}
+
+/** Get the rate at which the DMP writes packets to the FIFO.
+ * @return Packets per second
+ * @see dmpSetFIFORate()
+ */
+uint8_t MPU6050::dmpGetFIFORate() {
+    return MPU6050_DMP_SAMPLE_RATE / (1 + dmpFIFORateDivisor);
+}
+
+/** Get the time between two FIFO packets.
+ * @return Packet period in milliseconds
+ */
+uint16_t MPU6050::dmpGetSampleStepSizeMS() {
+    return (1000 / MPU6050_DMP_SAMPLE_RATE) * (1 + dmpFIFORateDivisor);
+}
+
+/** Get the rate at which the DMP itself runs, whatever the FIFO rate.
+ * @return Samples per second
+ */
+uint8_t MPU6050::dmpGetSampleFrequency() {
+    return MPU6050_DMP_SAMPLE_RATE;
+}
+
 // int32_t MPU6050::dmpDecodeTemperature(int8_t tempReg);
 
 //uint8_t MPU6050::dmpRegisterFIFORateProcess(inv_obj_func func, int16_t priority);
@@ -407,49 +643,48 @@ bool MPU6050::dmpPacketAvailable() {
 // uint8_t MPU6050::dmpSendEIS(uint_fast16_t elements, uint_fast16_t accuracy);
 
 uint8_t MPU6050::dmpGetAccel(int32_t *data, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
-    if (packet == 0) packet = dmpPacketBuffer;
-    data[0] = (((uint32_t)packet[16] << 8) | packet[17]);
-    data[1] = (((uint32_t)packet[18] << 8) | packet[19]);
-    data[2] = (((uint32_t)packet[20] << 8) | packet[21]);
+    const uint8_t *p = dmpGetField(MPU6050_DMP_FIELD_ACCEL, packet);
+    if (p == 0) return 1;
+    data[0] = (((uint32_t)p[0] << 8) | p[1]);
+    data[1] = (((uint32_t)p[2] << 8) | p[3]);
+    data[2] = (((uint32_t)p[4] << 8) | p[5]);
     return 0;
 }
 uint8_t MPU6050::dmpGetAccel(int16_t *data, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
-    if (packet == 0) packet = dmpPacketBuffer;
-    data[0] = (packet[16] << 8) | packet[17];
-    data[1] = (packet[18] << 8) | packet[19];
-    data[2] = (packet[20] << 8) | packet[21];
+    const uint8_t *p = dmpGetField(MPU6050_DMP_FIELD_ACCEL, packet);
+    if (p == 0) return 1;
+    data[0] = (p[0] << 8) | p[1];
+    data[1] = (p[2] << 8) | p[3];
+    data[2] = (p[4] << 8) | p[5];
     return 0;
 }
 uint8_t MPU6050::dmpGetAccel(VectorInt16 *v, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
-    if (packet == 0) packet = dmpPacketBuffer;
-    v -> x = (packet[16] << 8) | packet[17];
-    v -> y = (packet[18] << 8) | packet[19];
-    v -> z = (packet[20] << 8) | packet[21];
+    const uint8_t *p = dmpGetField(MPU6050_DMP_FIELD_ACCEL, packet);
+    if (p == 0) return 1;
+    v -> x = (p[0] << 8) | p[1];
+    v -> y = (p[2] << 8) | p[3];
+    v -> z = (p[4] << 8) | p[5];
     return 0;
 }
 uint8_t MPU6050::dmpGetQuaternion(int32_t *data, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
-    if (packet == 0) packet = dmpPacketBuffer;
-    data[0] = (((uint32_t)packet[0] << 24) | ((uint32_t)packet[1] << 16) | ((uint32_t)packet[2] << 8) | packet[3]);
-    data[1] = (((uint32_t)packet[4] << 24) | ((uint32_t)packet[5] << 16) | ((uint32_t)packet[6] << 8) | packet[7]);
-    data[2] = (((uint32_t)packet[8] << 24) | ((uint32_t)packet[9] << 16) | ((uint32_t)packet[10] << 8) | packet[11]);
-    data[3] = (((uint32_t)packet[12] << 24) | ((uint32_t)packet[13] << 16) | ((uint32_t)packet[14] << 8) | packet[15]);
+    const uint8_t *p = dmpGetField(MPU6050_DMP_FIELD_QUATERNION, packet);
+    if (p == 0) return 1;
+    data[0] = (((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]);
+    data[1] = (((uint32_t)p[4] << 24) | ((uint32_t)p[5] << 16) | ((uint32_t)p[6] << 8) | p[7]);
+    data[2] = (((uint32_t)p[8] << 24) | ((uint32_t)p[9] << 16) | ((uint32_t)p[10] << 8) | p[11]);
+    data[3] = (((uint32_t)p[12] << 24) | ((uint32_t)p[13] << 16) | ((uint32_t)p[14] << 8) | p[15]);
     return 0;
 }
 uint8_t MPU6050::dmpGetQuaternion(int16_t *data, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
-    if (packet == 0) packet = dmpPacketBuffer;
-    data[0] = ((packet[0] << 8) | packet[1]);
-    data[1] = ((packet[4] << 8) | packet[5]);
-    data[2] = ((packet[8] << 8) | packet[9]);
-    data[3] = ((packet[12] << 8) | packet[13]);
+    const uint8_t *p = dmpGetField(MPU6050_DMP_FIELD_QUATERNION, packet);
+    if (p == 0) return 1;
+    data[0] = ((p[0] << 8) | p[1]);
+    data[1] = ((p[4] << 8) | p[5]);
+    data[2] = ((p[8] << 8) | p[9]);
+    data[3] = ((p[12] << 8) | p[13]);
     return 0;
 }
 uint8_t MPU6050::dmpGetQuaternion(Quaternion *q, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
     int16_t qI[4];
     uint8_t status = dmpGetQuaternion(qI, packet);
     if (status == 0) {
@@ -461,30 +696,37 @@ uint8_t MPU6050::dmpGetQuaternion(Quaternion *q, const uint8_t* packet) {
     }
     return status; // int16 return value, indicates error if this line is reached
 }
+uint8_t MPU6050::dmpGetQuaternion(QuaternionArray *q, const uint8_t* packets, uint16_t length) {
+    // decode "length" consecutive FIFO packets (e.g. one multi-packet FIFO read) into SoA form
+    int8_t offset = dmpFieldOffset[MPU6050_DMP_FIELD_QUATERNION];
+    if (offset < 0) return 1;
+    q -> setFromPackets(packets + offset, dmpPacketSize, length);
+    return 0;
+}
 // uint8_t MPU6050::dmpGet6AxisQuaternion(long *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetRelativeQuaternion(long *data, const uint8_t* packet);
 uint8_t MPU6050::dmpGetGyro(int32_t *data, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
-    if (packet == 0) packet = dmpPacketBuffer;
-    data[0] = (((uint32_t)packet[22] << 8) | packet[23]);
-    data[1] = (((uint32_t)packet[24] << 8) | packet[25]);
-    data[2] = (((uint32_t)packet[26] << 8) | packet[27]);
+    const uint8_t *p = dmpGetField(MPU6050_DMP_FIELD_GYRO, packet);
+    if (p == 0) return 1;
+    data[0] = (((uint32_t)p[0] << 8) | p[1]);
+    data[1] = (((uint32_t)p[2] << 8) | p[3]);
+    data[2] = (((uint32_t)p[4] << 8) | p[5]);
     return 0;
 }
 uint8_t MPU6050::dmpGetGyro(int16_t *data, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
-    if (packet == 0) packet = dmpPacketBuffer;
-    data[0] = (packet[22] << 8) | packet[23];
-    data[1] = (packet[24] << 8) | packet[25];
-    data[2] = (packet[26] << 8) | packet[27];
+    const uint8_t *p = dmpGetField(MPU6050_DMP_FIELD_GYRO, packet);
+    if (p == 0) return 1;
+    data[0] = (p[0] << 8) | p[1];
+    data[1] = (p[2] << 8) | p[3];
+    data[2] = (p[4] << 8) | p[5];
     return 0;
 }
 uint8_t MPU6050::dmpGetGyro(VectorInt16 *v, const uint8_t* packet) {
-    // TODO: accommodate different arrangements of sent data (ONLY default supported now)
-    if (packet == 0) packet = dmpPacketBuffer;
-    v -> x = (packet[22] << 8) | packet[23];
-    v -> y = (packet[24] << 8) | packet[25];
-    v -> z = (packet[26] << 8) | packet[27];
+    const uint8_t *p = dmpGetField(MPU6050_DMP_FIELD_GYRO, packet);
+    if (p == 0) return 1;
+    v -> x = (p[0] << 8) | p[1];
+    v -> y = (p[2] << 8) | p[3];
+    v -> z = (p[4] << 8) | p[5];
     return 0;
 }
 // uint8_t MPU6050::dmpSetLinearAccelFilterCoefficient(float coef);
@@ -504,6 +746,10 @@ uint8_t MPU6050::dmpGetLinearAccelInWorld(VectorInt16 *v, VectorInt16 *vReal, Qu
     v -> rotate(q);
     return 0;
 }
+uint8_t MPU6050::dmpGetLinearAccelInWorld(VectorInt16Array *v, VectorInt16Array *vReal, QuaternionArray *q, uint16_t length) {
+    v -> rotate(vReal, q, length);
+    return 0;
+}
 // uint8_t MPU6050::dmpGetGyroAndAccelSensor(long *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetGyroSensor(long *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetControlData(long *data, const uint8_t* packet);
@@ -526,6 +772,11 @@ uint8_t MPU6050::dmpGetGravity(VectorFloat *v, Quaternion *q) {
     v -> z = q -> w*q -> w - q -> x*q -> x - q -> y*q -> y + q -> z*q -> z;
     return 0;
 }
+
+uint8_t MPU6050::dmpGetGravity(VectorFloatArray *v, QuaternionArray *q, uint16_t length) {
+    v -> setGravity(q, length);
+    return 0;
+}
 // uint8_t MPU6050::dmpGetUnquantizedAccel(long *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetQuantizedAccel(long *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetExternalSensorData(long *data, int size, const uint8_t* packet);
@@ -567,6 +818,16 @@ uint8_t MPU6050::dmpGetYawPitchRoll(float *data, Quaternion *q, VectorFloat *gra
 }
 #endif
 
+uint8_t MPU6050::dmpGetYawPitchRoll(VectorFloatArray *data, QuaternionArray *q, VectorFloatArray *gravity, uint16_t length) {
+    // yaw/pitch/roll end up in data -> x/y/z respectively (same order as the float[3] variant)
+#ifdef USE_OLD_DMPGETYAWPITCHROLL
+    data -> setYawPitchRollOld(q, gravity, length);
+#else
+    data -> setYawPitchRoll(q, gravity, length);
+#endif
+    return 0;
+}
+
 // uint8_t MPU6050::dmpGetAccelFloat(float *data, const uint8_t* packet);
 // uint8_t MPU6050::dmpGetQuaternionFloat(float *data, const uint8_t* packet);
 
@@ -612,6 +873,144 @@ uint16_t MPU6050::dmpGetFIFOPacketSize() {
 
 
 
+/** Get the newest packet from the FIFO.
+ * As GetCurrentFIFOPacket(), but a packet that fails dmpValidatePacket()
+ * is dropped (counted as invalid in getFIFOStats()) and 0 is returned, so
+ * the caller keeps its last good sample instead of using a corrupt one.
+ * @param data Buffer for dmpGetFIFOPacketSize() bytes
+ * @return 1 for a packet, 2 for a packet after recovering from an
+ *         overflow, 0 if no valid packet is available
+ */
 uint8_t MPU6050::dmpGetCurrentFIFOPacket(uint8_t *data) { // overflow proof
-    return(GetCurrentFIFOPacket(data, dmpPacketSize));
+    uint8_t status = GetCurrentFIFOPacket(data, dmpPacketSize);
+    if (status && dmpValidatePacket(data) != MPU6050_DMP_PACKET_OK) {
+        fifoStats.delivered--;
+        fifoStats.dropped++;
+        fifoStats.invalid++;
+        return 0;
+    }
+    return status;
+}
+
+/** Get the oldest packets from the FIFO, checked and realigned.
+ * Reads like getFIFOPackets() and checks every packet with
+ * dmpValidatePacket(). A bad packet is either corrupt or the first sign of
+ * a FIFO that is no longer read on packet boundaries (e.g. after an
+ * interrupted transfer). Since the DMP writes whole packets, FIFO_COUNT
+ * modulo the packet size tells how far the head is from the next
+ * boundary, provided two reads agree (otherwise a packet is being written
+ * and the remainder means nothing). If it is off and the packet starting
+ * that far into the slot validates, the packets already read are shifted
+ * back into place, the partial packets at both ends are dropped and the
+ * FIFO is realigned by skipping the few bytes left of the last one, with
+ * no FIFO reset. For the last slot the shifted packet runs into the FIFO,
+ * so those bytes are read to complete it and it is validated in place.
+ * The FIFO is realigned at most once per call. Realignments are counted as
+ * resyncs, rejected packets as invalid.
+ * @param data Buffer for maxPackets * dmpGetFIFOPacketSize() bytes
+ * @param maxPackets Most packets to read
+ * @return Number of valid packets in data
+ */
+uint16_t MPU6050::dmpGetFIFOPackets(uint8_t *data, uint16_t maxPackets) {
+    uint16_t size = dmpPacketSize;
+    uint16_t packets = getFIFOPackets(data, maxPackets, size);
+    uint16_t good = 0;
+    bool realigned = false;
+    for (uint16_t i = 0; i < packets; i++) {
+        uint8_t *packet = data + (uint32_t)i*size;
+        if (dmpValidatePacket(packet) == MPU6050_DMP_PACKET_OK) {
+            if (good != i) memmove(data + (uint32_t)good*size, packet, size);
+            good++;
+            continue;
+        }
+        uint16_t shift = 0;
+        if (!realigned) {
+            uint16_t fifoC = getFIFOCount();
+            if (fifoC == getFIFOCount()) shift = fifoC % size;
+        }
+        if (shift && i + 1 == packets) {
+            // complete the shifted packet with the bytes still in the FIFO,
+            // which realigns it, and drop the partial one in front
+            memmove(packet, packet + shift, size - shift);
+            getFIFOBytes(packet + size - shift, shift);
+            realigned = true;
+            fifoStats.resyncs++;
+            fifoStats.dropped++;
+            i--; // validate the completed packet
+            continue;
+        }
+        if (shift && dmpValidatePacket(packet + shift) == MPU6050_DMP_PACKET_OK) {
+            // packets start shift bytes into each slot from here on: move
+            // the whole ones back, drop the partial ones at both ends
+            memmove(packet, packet + shift, (uint32_t)(packets - i)*size - shift);
+            skipFIFOBytes(shift, micros());
+            realigned = true;
+            fifoStats.resyncs++;
+            fifoStats.delivered--;
+            fifoStats.dropped += 2;
+            packets--;
+            i--; // revalidate the packet now in slot i
+            continue;
+        }
+        fifoStats.delivered--;
+        fifoStats.dropped++;
+        fifoStats.invalid++;
+    }
+    return good;
+}
+
+/** Check that a packet looks like DMP output.
+ * The quaternion (if sent) must have unit norm, which random or shifted
+ * bytes almost never do; accel and gyro (if sent) must be within the
+ * limits set with dmpSetPacketLimits(), if any.
+ * @param packet Packet, or 0 for the internal buffer
+ * @return MPU6050_DMP_PACKET_OK, or an OR of MPU6050_DMP_PACKET_BAD_* values
+ */
+uint8_t MPU6050::dmpValidatePacket(const uint8_t *packet) {
+    uint8_t result = MPU6050_DMP_PACKET_OK;
+    const uint8_t *p = dmpGetField(MPU6050_DMP_FIELD_QUATERNION, packet);
+    if (p) {
+        // q14 high words; no component of a unit quaternion exceeds 1
+        uint32_t norm = 0;
+        for (uint8_t i = 0; i < 16; i += 4) {
+            int32_t q = (int16_t)((p[i] << 8) | p[i + 1]);
+            if (q > 16384 + 256 || q < -16384 - 256) {
+                norm = 0;
+                break;
+            }
+            norm += q*q;
+        }
+        int32_t error = (int32_t)(norm - (1UL << 28));
+        if (error > (int32_t)((1UL << 28) / MPU6050_DMP_QUAT_NORM_TOLERANCE) ||
+            error < -(int32_t)((1UL << 28) / MPU6050_DMP_QUAT_NORM_TOLERANCE)) {
+            result |= MPU6050_DMP_PACKET_BAD_QUATERNION;
+        }
+    }
+    int16_t limits[2] = { dmpAccelLimit, dmpGyroLimit };
+    uint8_t fields[2] = { MPU6050_DMP_FIELD_ACCEL, MPU6050_DMP_FIELD_GYRO };
+    uint8_t flags[2] = { MPU6050_DMP_PACKET_BAD_ACCEL, MPU6050_DMP_PACKET_BAD_GYRO };
+    for (uint8_t f = 0; f < 2; f++) {
+        if (limits[f] == 0 || (p = dmpGetField(fields[f], packet)) == 0) continue;
+        for (uint8_t i = 0; i < 6; i += 2) {
+            int16_t v = (p[i] << 8) | p[i + 1];
+            if (v > limits[f] || v < -limits[f]) {
+                result |= flags[f];
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+/** Set the accel and gyro range dmpValidatePacket() accepts.
+ * Raw sensor counts at the configured full scale. Leave a limit at 0 (the
+ * default) to accept any value; otherwise set it a little above the
+ * largest reading the application can see, so that packets read from a
+ * misaligned FIFO are caught even when their quaternion looks valid.
+ * @param accelLimit Largest accepted |accel| component, 0 for no limit
+ * @param gyroLimit Largest accepted |gyro| component, 0 for no limit
+ */
+void MPU6050::dmpSetPacketLimits(int16_t accelLimit, int16_t gyroLimit) {
+    dmpAccelLimit = accelLimit;
+    dmpGyroLimit = gyroLimit;
 }
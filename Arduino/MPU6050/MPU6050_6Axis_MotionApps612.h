@@ -4,6 +4,9 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//  2026/10/19 - add DMP packet validation (dmpValidatePacket) and realigning dmpGetFIFOPackets()
+//  2026/10/19 - implement dmpSetFIFORate()/dmpGetFIFORate()
+//  2026/10/19 - add DMP output feature selection (dmpSetFeatures) and packet layout table
 //  2021/09/27 - split implementations out of header files, finally
 //     ... - ongoing debug release
 
@@ -43,6 +46,35 @@ THE SOFTWARE.
 
 #include "MPU6050.h"
 
+// DMP output features for dmpSetFeatures(), same bit values as the InvenSense eMPL driver
+#define MPU6050_DMP_FEATURE_TAP             0x001   // tap events in the gesture word
+#define MPU6050_DMP_FEATURE_ANDROID_ORIENT  0x002   // screen orientation events in the gesture word
+#define MPU6050_DMP_FEATURE_LP_QUAT         0x004   // gyro-only (3-axis) quaternion
+#define MPU6050_DMP_FEATURE_6X_LP_QUAT      0x010   // gyro + accel (6-axis) quaternion
+#define MPU6050_DMP_FEATURE_GYRO_CAL        0x020   // recalibrate the gyro bias whenever the device is still
+#define MPU6050_DMP_FEATURE_SEND_RAW_ACCEL  0x040
+#define MPU6050_DMP_FEATURE_SEND_RAW_GYRO   0x080
+#define MPU6050_DMP_FEATURE_SEND_CAL_GYRO   0x100   // gyro with the DMP's bias removed
+
+// what dmpInitialize() leaves configured (the layout the DMP image was captured with)
+#define MPU6050_DMP_FEATURE_DEFAULT         (MPU6050_DMP_FEATURE_6X_LP_QUAT | MPU6050_DMP_FEATURE_SEND_RAW_ACCEL | \
+                                             MPU6050_DMP_FEATURE_SEND_CAL_GYRO | MPU6050_DMP_FEATURE_GYRO_CAL)
+
+// fields of a DMP FIFO packet, in the order the DMP writes them
+#define MPU6050_DMP_FIELD_QUATERNION        0   // 16 bytes, 4x int32 (q30)
+#define MPU6050_DMP_FIELD_ACCEL             1   // 6 bytes, 3x int16
+#define MPU6050_DMP_FIELD_GYRO              2   // 6 bytes, 3x int16
+#define MPU6050_DMP_FIELD_GESTURE           3   // 4 bytes, tap/orientation events
+#define MPU6050_DMP_FIELD_COUNT             4
+
+// dmpValidatePacket() results, OR'ed together
+#define MPU6050_DMP_PACKET_OK               0x00
+#define MPU6050_DMP_PACKET_BAD_QUATERNION   0x01    // norm not 1 within MPU6050_DMP_QUAT_NORM_TOLERANCE
+#define MPU6050_DMP_PACKET_BAD_ACCEL        0x02    // beyond the dmpSetPacketLimits() accel limit
+#define MPU6050_DMP_PACKET_BAD_GYRO         0x04    // beyond the dmpSetPacketLimits() gyro limit
+
+#define MPU6050_DMP_QUAT_NORM_TOLERANCE     64      // squared norm may be off by 1/64 (q14 truncation is ~1/2000)
+
 class MPU6050_6Axis_MotionApps612 : public MPU6050_Base {
     public:
         MPU6050_6Axis_MotionApps612(uint8_t address=MPU6050_DEFAULT_ADDRESS, void *wireObj=0) : MPU6050_Base(address, wireObj) { }
@@ -52,7 +84,7 @@ class MPU6050_6Axis_MotionApps612 : public MPU6050_Base {
 
         uint8_t dmpSetFIFORate(uint8_t fifoRate);
         uint8_t dmpGetFIFORate();
-        uint8_t dmpGetSampleStepSizeMS();
+        uint16_t dmpGetSampleStepSizeMS();
         uint8_t dmpGetSampleFrequency();
         int32_t dmpDecodeTemperature(int8_t tempReg);
         
@@ -82,6 +114,7 @@ class MPU6050_6Axis_MotionApps612 : public MPU6050_Base {
         uint8_t dmpGetQuaternion(int32_t *data, const uint8_t* packet=0);
         uint8_t dmpGetQuaternion(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGetQuaternion(Quaternion *q, const uint8_t* packet=0);
+        uint8_t dmpGetQuaternion(QuaternionArray *q, const uint8_t* packets, uint16_t length);
         uint8_t dmpGet6AxisQuaternion(int32_t *data, const uint8_t* packet=0);
         uint8_t dmpGet6AxisQuaternion(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGet6AxisQuaternion(Quaternion *q, const uint8_t* packet=0);
@@ -100,6 +133,7 @@ class MPU6050_6Axis_MotionApps612 : public MPU6050_Base {
         uint8_t dmpGetLinearAccelInWorld(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGetLinearAccelInWorld(VectorInt16 *v, const uint8_t* packet=0);
         uint8_t dmpGetLinearAccelInWorld(VectorInt16 *v, VectorInt16 *vReal, Quaternion *q);
+        uint8_t dmpGetLinearAccelInWorld(VectorInt16Array *v, VectorInt16Array *vReal, QuaternionArray *q, uint16_t length);
         uint8_t dmpGetGyroAndAccelSensor(int32_t *data, const uint8_t* packet=0);
         uint8_t dmpGetGyroAndAccelSensor(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGetGyroAndAccelSensor(VectorInt16 *g, VectorInt16 *a, const uint8_t* packet=0);
@@ -112,6 +146,7 @@ class MPU6050_6Axis_MotionApps612 : public MPU6050_Base {
         uint8_t dmpGetGravity(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGetGravity(VectorInt16 *v, const uint8_t* packet=0);
         uint8_t dmpGetGravity(VectorFloat *v, Quaternion *q);
+        uint8_t dmpGetGravity(VectorFloatArray *v, QuaternionArray *q, uint16_t length);
         uint8_t dmpGetUnquantizedAccel(int32_t *data, const uint8_t* packet=0);
         uint8_t dmpGetUnquantizedAccel(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGetUnquantizedAccel(VectorInt16 *v, const uint8_t* packet=0);
@@ -123,6 +158,7 @@ class MPU6050_6Axis_MotionApps612 : public MPU6050_Base {
         
         uint8_t dmpGetEuler(float *data, Quaternion *q);
         uint8_t dmpGetYawPitchRoll(float *data, Quaternion *q, VectorFloat *gravity);
+        uint8_t dmpGetYawPitchRoll(VectorFloatArray *data, QuaternionArray *q, VectorFloatArray *gravity, uint16_t length);
 
         // Get Floating Point data from FIFO
         uint8_t dmpGetAccelFloat(float *data, const uint8_t* packet=0);
@@ -142,10 +178,28 @@ class MPU6050_6Axis_MotionApps612 : public MPU6050_Base {
         void dmpOverrideQuaternion(long *q);
         uint16_t dmpGetFIFOPacketSize();
         uint8_t dmpGetCurrentFIFOPacket(uint8_t *data); // overflow proof
+        uint16_t dmpGetFIFOPackets(uint8_t *data, uint16_t maxPackets);
+        uint8_t dmpValidatePacket(const uint8_t *packet=0);
+        void dmpSetPacketLimits(int16_t accelLimit, int16_t gyroLimit);
+
+        // Select FIFO output
+        uint8_t dmpSetFeatures(uint16_t features);
+        uint16_t dmpGetFeatures();
+        int8_t dmpGetFieldOffset(uint8_t field);
+        uint8_t dmpGetTap(uint8_t *direction, uint8_t *count, const uint8_t* packet=0);
+        uint8_t dmpGetOrientation(uint8_t *orientation, const uint8_t* packet=0);
 
     private:
+        const uint8_t *dmpGetField(uint8_t field, const uint8_t *packet);
+        void dmpUpdateLayout();
+
         uint8_t *dmpPacketBuffer;
         uint16_t dmpPacketSize;
+        uint8_t dmpFIFORateDivisor;
+        uint16_t dmpFeatures;
+        int8_t dmpFieldOffset[MPU6050_DMP_FIELD_COUNT];   // -1 for fields not in the packet
+        int16_t dmpAccelLimit = 0;  // 0 for no limit
+        int16_t dmpGyroLimit = 0;
 };
 
 typedef MPU6050_6Axis_MotionApps612 MPU6050;
@@ -4,6 +4,8 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//  2026/10/19 - reset and register setup run from I2CdevConfig tables: reset is polled, neighbouring registers burst written
+//  2026/10/19 - implement dmpSetFIFORate()/dmpGetFIFORate(), the output divisor is no longer fixed at build time
 //  2021/09/27 - split implementations out of header files, finally
 
 /* ============================================
@@ -34,6 +36,7 @@ THE SOFTWARE.
 #define MPU6050_INCLUDE_DMP_MOTIONAPPS41
 
 #include "MPU6050_9Axis_MotionApps41.h"
+#include "I2CdevConfig.h"
 
 // Tom Carpenter's conditional PROGMEM code
 // http://forum.arduino.cc/index.php?topic=129407.0
@@ -262,6 +265,10 @@ static const unsigned char dmpMemory[MPU6050_DMP_CODE_SIZE] PROGMEM = {
 #define MPU6050_DMP_FIFO_RATE_DIVISOR 0x03
 #endif
 
+#define MPU6050_DMP_SAMPLE_RATE     200     // Hz, SMPLRT_DIV as set by dmpInitialize()
+#define MPU6050_DMP_FIFO_RATE_BANK  0x02    // D_0_22: 16-bit big-endian FIFO output divisor
+#define MPU6050_DMP_FIFO_RATE_ADDR  0x16
+
 static const unsigned char dmpConfig[MPU6050_DMP_CONFIG_SIZE] PROGMEM = {
 //  BANK    OFFSET  LENGTH  [DATA]
     0x02,   0xEC,   0x04,   0x00, 0x47, 0x7D, 0x1A,   // ?
@@ -334,15 +341,31 @@ const unsigned char dmpUpdates[MPU6050_DMP_UPDATES_SIZE] PROGMEM = {
     0x00,   0x60,   0x04,   0x00, 0x40, 0x00, 0x00
 };
 
+static const I2CdevConfigStep dmpResetProfile[] PROGMEM = {
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_PWR_MGMT_1, 0x80),           // DEVICE_RESET
+    I2CDEV_CONFIG_POLL(MPU6050_RA_PWR_MGMT_1, 0x80, 0x00, 100), // the bit clears when the reset is done
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_PWR_MGMT_1, 0x00),           // out of sleep mode
+    I2CDEV_CONFIG_END
+};
+
+// register setup once the DMP code and configuration are loaded
+static const I2CdevConfigStep dmpSetupProfile[] PROGMEM = {
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_INT_ENABLE, (1<<MPU6050_INTERRUPT_FIFO_OFLOW_BIT)|(1<<MPU6050_INTERRUPT_DMP_INT_BIT)),
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_PWR_MGMT_1, MPU6050_CLOCK_PLL_ZGYRO),
+    // one burst for SMPLRT_DIV..GYRO_CONFIG
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_SMPLRT_DIV, 4),              // 1khz / (1 + 4) = 200 Hz
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_CONFIG, (MPU6050_EXT_SYNC_TEMP_OUT_L << 3) | MPU6050_DLPF_BW_42),
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_GYRO_CONFIG, MPU6050_GYRO_FS_2000 << 3), // +/- 2000 deg/sec
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_DMP_CFG_1, 0x03),            // function unknown
+    I2CDEV_CONFIG_WRITE(MPU6050_RA_DMP_CFG_2, 0x00),
+    I2CDEV_CONFIG_MODIFY(MPU6050_RA_XG_OFFS_TC, 0x01, 0x00),    // clear OTP bank valid, keep the gyro trim
+    I2CDEV_CONFIG_END
+};
+
 uint8_t MPU6050_9Axis_MotionApps41::dmpInitialize() {
-    // reset device
+    // reset device and disable sleep mode
     DEBUG_PRINTLN(F("\n\nResetting MPU6050..."));
-    reset();
-    delay(30); // wait after reset
-
-    // disable sleep mode
-    DEBUG_PRINTLN(F("Disabling sleep mode..."));
-    setSleepEnabled(false);
+    if (I2CdevConfig::apply(devAddr, dmpResetProfile, wireObj)) return 1; // no answer
 
     // get MPU product ID
     DEBUG_PRINTLN(F("Getting product ID..."));
@@ -436,30 +459,8 @@ uint8_t MPU6050_9Axis_MotionApps41::dmpInitialize() {
         if (writeProgDMPConfigurationSet(dmpConfig, MPU6050_DMP_CONFIG_SIZE)) {
             DEBUG_PRINTLN(F("Success! DMP configuration written and verified."));
 
-            DEBUG_PRINTLN(F("Setting DMP and FIFO_OFLOW interrupts enabled..."));
-            setIntEnabled(1<<MPU6050_INTERRUPT_FIFO_OFLOW_BIT|1<<MPU6050_INTERRUPT_DMP_INT_BIT);
-
-            DEBUG_PRINTLN(F("Setting sample rate to 200Hz..."));
-            setRate(4); // 1khz / (1 + 4) = 200 Hz
-
-            DEBUG_PRINTLN(F("Setting clock source to Z Gyro..."));
-            setClockSource(MPU6050_CLOCK_PLL_ZGYRO);
-
-            DEBUG_PRINTLN(F("Setting DLPF bandwidth to 42Hz..."));
-            setDLPFMode(MPU6050_DLPF_BW_42);
-
-            DEBUG_PRINTLN(F("Setting external frame sync to TEMP_OUT_L[0]..."));
-            setExternalFrameSync(MPU6050_EXT_SYNC_TEMP_OUT_L);
-
-            DEBUG_PRINTLN(F("Setting gyro sensitivity to +/- 2000 deg/sec..."));
-            setFullScaleGyroRange(MPU6050_GYRO_FS_2000);
-
-            DEBUG_PRINTLN(F("Setting DMP configuration bytes (function unknown)..."));
-            setDMPConfig1(0x03);
-            setDMPConfig2(0x00);
-
-            DEBUG_PRINTLN(F("Clearing OTP Bank flag..."));
-            setOTPBankValid(false);
+            DEBUG_PRINTLN(F("Setting interrupts, Z gyro clock, 200Hz sample rate, 42Hz DLPF, +/- 2000 deg/sec, DMP config..."));
+            if (I2CdevConfig::apply(devAddr, dmpSetupProfile, wireObj)) return 2;
 
             DEBUG_PRINTLN(F("Setting X/Y/Z gyro offsets to previous values..."));
             setXGyroOffsetTC(xgOffset);
@@ -637,6 +638,8 @@ uint8_t MPU6050_9Axis_MotionApps41::dmpInitialize() {
 
             DEBUG_PRINTLN(F("Setting up internal 48-byte (default) DMP packet buffer..."));
             dmpPacketSize = 48;
+            dmpFIFORateDivisor = MPU6050_DMP_FIFO_RATE_DIVISOR;
+            fifoPacketPeriod = 1000000UL / MPU6050_DMP_SAMPLE_RATE * (1 + dmpFIFORateDivisor);
             /*if ((dmpPacketBuffer = (uint8_t *)malloc(42)) == 0) {
                 return 3; // TODO: proper error code for no memory
             }*/
@@ -659,10 +662,48 @@ bool MPU6050_9Axis_MotionApps41::dmpPacketAvailable() {
     return getFIFOCount() >= dmpGetFIFOPacketSize();
 }
 
-// uint8_t MPU6050_9Axis_MotionApps41::dmpSetFIFORate(uint8_t fifoRate);
-// uint8_t MPU6050_9Axis_MotionApps41::dmpGetFIFORate();
-// uint8_t MPU6050_9Axis_MotionApps41::dmpGetSampleStepSizeMS();
-// uint8_t MPU6050_9Axis_MotionApps41::dmpGetSampleFrequency();
+/** Set the rate at which the DMP writes packets to the FIFO.
+ * The DMP computes a result at every sample (200 Hz) and queues every
+ * (1 + divisor)th one, so the rate used is the nearest one at or above the
+ * request that 200 Hz divides into (e.g. 60 Hz gives 66 Hz). Lower rates
+ * cut FIFO reads and bus load, higher ones cut latency. Takes effect
+ * immediately; the DMP can stay enabled.
+ * @param fifoRate Packets per second, 1-200
+ * @return 0 on success, 1 if out of range, 2 if the DMP memory write failed
+ * @see dmpGetFIFORate()
+ */
+uint8_t MPU6050_9Axis_MotionApps41::dmpSetFIFORate(uint8_t fifoRate) {
+    if (fifoRate == 0 || fifoRate > MPU6050_DMP_SAMPLE_RATE) return 1;
+    uint8_t divisor = MPU6050_DMP_SAMPLE_RATE / fifoRate - 1;
+    uint8_t data[2] = { 0x00, divisor };
+    if (!writeMemoryBlock(data, 2, MPU6050_DMP_FIFO_RATE_BANK, MPU6050_DMP_FIFO_RATE_ADDR)) return 2;
+    dmpFIFORateDivisor = divisor;
+    fifoPacketPeriod = 1000000UL / MPU6050_DMP_SAMPLE_RATE * (1 + divisor);
+    return 0;
+}
+
+/** Get the rate at which the DMP writes packets to the FIFO.
+ * @return Packets per second
+ * @see dmpSetFIFORate()
+ */
+uint8_t MPU6050_9Axis_MotionApps41::dmpGetFIFORate() {
+    return MPU6050_DMP_SAMPLE_RATE / (1 + dmpFIFORateDivisor);
+}
+
+/** Get the time between two FIFO packets.
+ * @return Packet period in milliseconds
+ */
+uint16_t MPU6050_9Axis_MotionApps41::dmpGetSampleStepSizeMS() {
+    return (1000 / MPU6050_DMP_SAMPLE_RATE) * (1 + dmpFIFORateDivisor);
+}
+
+/** Get the rate at which the DMP itself runs, whatever the FIFO rate.
+ * @return Samples per second
+ */
+uint8_t MPU6050_9Axis_MotionApps41::dmpGetSampleFrequency() {
+    return MPU6050_DMP_SAMPLE_RATE;
+}
+
 // int32_t MPU6050_9Axis_MotionApps41::dmpDecodeTemperature(int8_t tempReg);
 
 //uint8_t MPU6050_9Axis_MotionApps41::dmpRegisterFIFORateProcess(inv_obj_func func, int16_t priority);
@@ -737,6 +778,11 @@ uint8_t MPU6050_9Axis_MotionApps41::dmpGetQuaternion(Quaternion *q, const uint8_
     }
     return status; // int16 return value, indicates error if this line is reached
 }
+uint8_t MPU6050_9Axis_MotionApps41::dmpGetQuaternion(QuaternionArray *q, const uint8_t* packets, uint16_t length) {
+    // decode "length" consecutive FIFO packets (e.g. one multi-packet FIFO read) into SoA form
+    q -> setFromPackets(packets, dmpPacketSize, length);
+    return 0;
+}
 // uint8_t MPU6050_9Axis_MotionApps41::dmpGet6AxisQuaternion(long *data, const uint8_t* packet);
 // uint8_t MPU6050_9Axis_MotionApps41::dmpGetRelativeQuaternion(long *data, const uint8_t* packet);
 uint8_t MPU6050_9Axis_MotionApps41::dmpGetGyro(int32_t *data, const uint8_t* packet) {
@@ -780,6 +826,10 @@ uint8_t MPU6050_9Axis_MotionApps41::dmpGetLinearAccelInWorld(VectorInt16 *v, Vec
     v -> rotate(q);
     return 0;
 }
+uint8_t MPU6050_9Axis_MotionApps41::dmpGetLinearAccelInWorld(VectorInt16Array *v, VectorInt16Array *vReal, QuaternionArray *q, uint16_t length) {
+    v -> rotate(vReal, q, length);
+    return 0;
+}
 // uint8_t MPU6050_9Axis_MotionApps41::dmpGetGyroAndAccelSensor(long *data, const uint8_t* packet);
 // uint8_t MPU6050_9Axis_MotionApps41::dmpGetGyroSensor(long *data, const uint8_t* packet);
 // uint8_t MPU6050_9Axis_MotionApps41::dmpGetControlData(long *data, const uint8_t* packet);
@@ -802,6 +852,11 @@ uint8_t MPU6050_9Axis_MotionApps41::dmpGetGravity(VectorFloat *v, Quaternion *q)
     v -> z = q -> w*q -> w - q -> x*q -> x - q -> y*q -> y + q -> z*q -> z;
     return 0;
 }
+
+uint8_t MPU6050_9Axis_MotionApps41::dmpGetGravity(VectorFloatArray *v, QuaternionArray *q, uint16_t length) {
+    v -> setGravity(q, length);
+    return 0;
+}
 // uint8_t MPU6050_9Axis_MotionApps41::dmpGetUnquantizedAccel(long *data, const uint8_t* packet);
 // uint8_t MPU6050_9Axis_MotionApps41::dmpGetQuantizedAccel(long *data, const uint8_t* packet);
 // uint8_t MPU6050_9Axis_MotionApps41::dmpGetExternalSensorData(long *data, int size, const uint8_t* packet);
@@ -843,6 +898,16 @@ uint8_t MPU6050_9Axis_MotionApps41::dmpGetYawPitchRoll(float *data, Quaternion *
 }
 #endif
 
+uint8_t MPU6050_9Axis_MotionApps41::dmpGetYawPitchRoll(VectorFloatArray *data, QuaternionArray *q, VectorFloatArray *gravity, uint16_t length) {
+    // yaw/pitch/roll end up in data -> x/y/z respectively (same order as the float[3] variant)
+#ifdef USE_OLD_DMPGETYAWPITCHROLL
+    data -> setYawPitchRollOld(q, gravity, length);
+#else
+    data -> setYawPitchRoll(q, gravity, length);
+#endif
+    return 0;
+}
+
 // uint8_t MPU6050_9Axis_MotionApps41::dmpGetAccelFloat(float *data, const uint8_t* packet);
 // uint8_t MPU6050_9Axis_MotionApps41::dmpGetQuaternionFloat(float *data, const uint8_t* packet);
 
@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//  2026/10/19 - implement dmpSetFIFORate()/dmpGetFIFORate()
 //  2021/09/27 - split implementations out of header files, finally
 //     ... - ongoing debug release
 
@@ -52,7 +53,7 @@ class MPU6050_9Axis_MotionApps41 : public MPU6050_Base {
 
         uint8_t dmpSetFIFORate(uint8_t fifoRate);
         uint8_t dmpGetFIFORate();
-        uint8_t dmpGetSampleStepSizeMS();
+        uint16_t dmpGetSampleStepSizeMS();
         uint8_t dmpGetSampleFrequency();
         int32_t dmpDecodeTemperature(int8_t tempReg);
         
@@ -82,6 +83,7 @@ class MPU6050_9Axis_MotionApps41 : public MPU6050_Base {
         uint8_t dmpGetQuaternion(int32_t *data, const uint8_t* packet=0);
         uint8_t dmpGetQuaternion(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGetQuaternion(Quaternion *q, const uint8_t* packet=0);
+        uint8_t dmpGetQuaternion(QuaternionArray *q, const uint8_t* packets, uint16_t length);
         uint8_t dmpGet6AxisQuaternion(int32_t *data, const uint8_t* packet=0);
         uint8_t dmpGet6AxisQuaternion(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGet6AxisQuaternion(Quaternion *q, const uint8_t* packet=0);
@@ -101,6 +103,7 @@ class MPU6050_9Axis_MotionApps41 : public MPU6050_Base {
         uint8_t dmpGetLinearAccelInWorld(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGetLinearAccelInWorld(VectorInt16 *v, const uint8_t* packet=0);
         uint8_t dmpGetLinearAccelInWorld(VectorInt16 *v, VectorInt16 *vReal, Quaternion *q);
+        uint8_t dmpGetLinearAccelInWorld(VectorInt16Array *v, VectorInt16Array *vReal, QuaternionArray *q, uint16_t length);
         uint8_t dmpGetGyroAndAccelSensor(int32_t *data, const uint8_t* packet=0);
         uint8_t dmpGetGyroAndAccelSensor(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGetGyroAndAccelSensor(VectorInt16 *g, VectorInt16 *a, const uint8_t* packet=0);
@@ -113,6 +116,7 @@ class MPU6050_9Axis_MotionApps41 : public MPU6050_Base {
         uint8_t dmpGetGravity(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGetGravity(VectorInt16 *v, const uint8_t* packet=0);
         uint8_t dmpGetGravity(VectorFloat *v, Quaternion *q);
+        uint8_t dmpGetGravity(VectorFloatArray *v, QuaternionArray *q, uint16_t length);
         uint8_t dmpGetUnquantizedAccel(int32_t *data, const uint8_t* packet=0);
         uint8_t dmpGetUnquantizedAccel(int16_t *data, const uint8_t* packet=0);
         uint8_t dmpGetUnquantizedAccel(VectorInt16 *v, const uint8_t* packet=0);
@@ -124,6 +128,7 @@ class MPU6050_9Axis_MotionApps41 : public MPU6050_Base {
         
         uint8_t dmpGetEuler(float *data, Quaternion *q);
         uint8_t dmpGetYawPitchRoll(float *data, Quaternion *q, VectorFloat *gravity);
+        uint8_t dmpGetYawPitchRoll(VectorFloatArray *data, QuaternionArray *q, VectorFloatArray *gravity, uint16_t length);
 
         // Get Floating Point data from FIFO
         uint8_t dmpGetAccelFloat(float *data, const uint8_t* packet=0);
@@ -146,6 +151,7 @@ class MPU6050_9Axis_MotionApps41 : public MPU6050_Base {
     private:
         uint8_t *dmpPacketBuffer;
         uint16_t dmpPacketSize;
+        uint8_t dmpFIFORateDivisor;
 };
 
 typedef MPU6050_9Axis_MotionApps41 MPU6050;
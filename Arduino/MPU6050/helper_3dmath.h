@@ -4,6 +4,9 @@
 //
 // Changelog:
 //     2012-06-05 - add 3D math helper file to DMP6 example sketch
+//     2026-10-19 - add SoA batch conversions (QuaternionArray, VectorInt16Array, VectorFloatArray)
+//     2026-10-19 - include math.h and stdint.h instead of relying on Arduino.h for them
+//     2026-10-19 - add VectorFloatArray::setYawPitchRollOld() for USE_OLD_DMPGETYAWPITCHROLL
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -32,6 +35,9 @@ THE SOFTWARE.
 #ifndef _HELPER_3DMATH_H_
 #define _HELPER_3DMATH_H_
 
+#include <stdint.h>
+#include <math.h>
+
 class Quaternion {
     public:
         float w;
@@ -213,4 +219,157 @@ class VectorFloat {
         }
 };
 
+// Structure-of-arrays (SoA) containers for converting a whole backlog of
+// samples at once. Each member points to a caller-owned contiguous array, so
+// the batch loops below touch memory linearly and can be auto-vectorized by
+// the compiler on hosts with SIMD units (SSE/NEON). Results match calling the
+// single-sample methods in a loop.
+class QuaternionArray {
+    public:
+        float *w;
+        float *x;
+        float *y;
+        float *z;
+
+        QuaternionArray(float *nw, float *nx, float *ny, float *nz) {
+            w = nw;
+            x = nx;
+            y = ny;
+            z = nz;
+        }
+
+        Quaternion get(uint16_t i) {
+            return Quaternion(w[i], x[i], y[i], z[i]);
+        }
+
+        void set(uint16_t i, Quaternion *q) {
+            w[i] = q -> w;
+            x[i] = q -> x;
+            y[i] = q -> y;
+            z[i] = q -> z;
+        }
+
+        // decode "length" DMP FIFO packets laid out back to back, "packetSize"
+        // bytes apart, each holding a big-endian 32-bit quaternion (w, x, y, z)
+        // at "packets"; only the high word of each element is used (1.0 = 16384)
+        void setFromPackets(const uint8_t *packets, uint16_t packetSize, uint16_t length) {
+            for (uint16_t i = 0; i < length; i++) {
+                const uint8_t *packet = packets + (uint32_t)i*packetSize;
+                w[i] = (float)(int16_t)((packet[0] << 8) | packet[1]) / 16384.0f;
+                x[i] = (float)(int16_t)((packet[4] << 8) | packet[5]) / 16384.0f;
+                y[i] = (float)(int16_t)((packet[8] << 8) | packet[9]) / 16384.0f;
+                z[i] = (float)(int16_t)((packet[12] << 8) | packet[13]) / 16384.0f;
+            }
+        }
+};
+
+class VectorInt16Array {
+    public:
+        int16_t *x;
+        int16_t *y;
+        int16_t *z;
+
+        VectorInt16Array(int16_t *nx, int16_t *ny, int16_t *nz) {
+            x = nx;
+            y = ny;
+            z = nz;
+        }
+
+        // batch equivalent of VectorInt16::rotate() for "length" samples,
+        // reading from "in" and writing here (in may be this same array)
+        void rotate(VectorInt16Array *in, QuaternionArray *q, uint16_t length) {
+            for (uint16_t i = 0; i < length; i++) {
+                float qw = q -> w[i], qx = q -> x[i], qy = q -> y[i], qz = q -> z[i];
+                float vx = in -> x[i], vy = in -> y[i], vz = in -> z[i];
+
+                // q * [0, v] (same term order as Quaternion::getProduct)
+                float tw = - qx*vx - qy*vy - qz*vz;
+                float tx = qw*vx + qy*vz - qz*vy;
+                float ty = qw*vy - qx*vz + qz*vx;
+                float tz = qw*vz + qx*vy - qy*vx;
+
+                // (q * [0, v]) * conj(q), w component discarded
+                x[i] = -tw*qx + tx*qw - ty*qz + tz*qy;
+                y[i] = -tw*qy + tx*qz + ty*qw - tz*qx;
+                z[i] = -tw*qz - tx*qy + ty*qx + tz*qw;
+            }
+        }
+};
+
+class VectorFloatArray {
+    public:
+        float *x;
+        float *y;
+        float *z;
+
+        VectorFloatArray(float *nx, float *ny, float *nz) {
+            x = nx;
+            y = ny;
+            z = nz;
+        }
+
+        // batch equivalent of VectorFloat::rotate() for "length" samples,
+        // reading from "in" and writing here (in may be this same array)
+        void rotate(VectorFloatArray *in, QuaternionArray *q, uint16_t length) {
+            for (uint16_t i = 0; i < length; i++) {
+                float qw = q -> w[i], qx = q -> x[i], qy = q -> y[i], qz = q -> z[i];
+                float vx = in -> x[i], vy = in -> y[i], vz = in -> z[i];
+
+                float tw = - qx*vx - qy*vy - qz*vz;
+                float tx = qw*vx + qy*vz - qz*vy;
+                float ty = qw*vy - qx*vz + qz*vx;
+                float tz = qw*vz + qx*vy - qy*vx;
+
+                x[i] = -tw*qx + tx*qw - ty*qz + tz*qy;
+                y[i] = -tw*qy + tx*qz + ty*qw - tz*qx;
+                z[i] = -tw*qz - tx*qy + ty*qx + tz*qw;
+            }
+        }
+
+        // batch equivalent of dmpGetGravity(VectorFloat *v, Quaternion *q)
+        void setGravity(QuaternionArray *q, uint16_t length) {
+            for (uint16_t i = 0; i < length; i++) {
+                float qw = q -> w[i], qx = q -> x[i], qy = q -> y[i], qz = q -> z[i];
+                x[i] = 2 * (qx*qz - qw*qy);
+                y[i] = 2 * (qw*qx + qy*qz);
+                z[i] = qw*qw - qx*qx - qy*qy + qz*qz;
+            }
+        }
+
+        // batch equivalent of dmpGetYawPitchRoll(float *data, Quaternion *q, VectorFloat *gravity),
+        // storing yaw in x[], pitch in y[] and roll in z[] (radians)
+        void setYawPitchRoll(QuaternionArray *q, VectorFloatArray *gravity, uint16_t length) {
+            for (uint16_t i = 0; i < length; i++) {
+                float qw = q -> w[i], qx = q -> x[i], qy = q -> y[i], qz = q -> z[i];
+                float gx = gravity -> x[i], gy = gravity -> y[i], gz = gravity -> z[i];
+
+                // yaw: (about Z axis)
+                float yaw = atan2f(2*qx*qy - 2*qw*qz, 2*qw*qw + 2*qx*qx - 1);
+                // pitch: (nose up/down, about Y axis)
+                float pitch = atan2f(gx, sqrtf(gy*gy + gz*gz));
+                // roll: (tilt left/right, about X axis)
+                float roll = atan2f(gy, gz);
+
+                // branch-free form of the upside-down pitch correction
+                float flipped = (pitch > 0 ? 3.14159265358979f : -3.14159265358979f) - pitch;
+                x[i] = yaw;
+                y[i] = (gz < 0) ? flipped : pitch;
+                z[i] = roll;
+            }
+        }
+
+        // batch equivalent of dmpGetYawPitchRoll() built with USE_OLD_DMPGETYAWPITCHROLL,
+        // where pitch and roll stay within +-90 degrees
+        void setYawPitchRollOld(QuaternionArray *q, VectorFloatArray *gravity, uint16_t length) {
+            for (uint16_t i = 0; i < length; i++) {
+                float qw = q -> w[i], qx = q -> x[i], qy = q -> y[i], qz = q -> z[i];
+                float gx = gravity -> x[i], gy = gravity -> y[i], gz = gravity -> z[i];
+
+                x[i] = atan2f(2*qx*qy - 2*qw*qz, 2*qw*qw + 2*qx*qx - 1);
+                y[i] = atanf(gx / sqrtf(gy*gy + gz*gz));
+                z[i] = atanf(gy / sqrtf(gx*gx + gz*gz));
+            }
+        }
+};
+
 #endif /* _HELPER_3DMATH_H_ */
\ No newline at end of file
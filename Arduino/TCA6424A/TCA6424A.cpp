@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - add output/direction shadow registers, writeMask() and togglePins()
 //     2011-07-31 - initial release
 
 /* ============================================
@@ -37,6 +38,8 @@ THE SOFTWARE.
  */
 TCA6424A::TCA6424A() {
     devAddr = TCA6424A_DEFAULT_ADDRESS;
+    outputShadow[0] = outputShadow[1] = outputShadow[2] = 0xFF;        // power-on defaults
+    directionShadow[0] = directionShadow[1] = directionShadow[2] = 0xFF;
 }
 
 /** Specific address constructor.
@@ -47,14 +50,18 @@ TCA6424A::TCA6424A() {
  */
 TCA6424A::TCA6424A(uint8_t address) {
     devAddr = address;
+    outputShadow[0] = outputShadow[1] = outputShadow[2] = 0xFF;        // power-on defaults
+    directionShadow[0] = directionShadow[1] = directionShadow[2] = 0xFF;
 }
 
 /** Power on and prepare for general usage.
  * The TCA6424A I/O expander requires no preparation after power-on. All pins
  * will be default to INPUT mode, and the device is ready for usage immediately.
- * This is an empty function for consistency and/or future expansion.
+ * The output and direction shadow registers are loaded from the device, in
+ * case it was configured before this sketch started.
  */
 void TCA6424A::initialize() {
+    refreshShadow();
 }
 
 /** Verify the I2C connection.
@@ -145,23 +152,32 @@ void TCA6424A::getAllOutputLevel(uint8_t *bank0, uint8_t *bank1, uint8_t *bank2)
     *bank2 = buffer[2];
 }
 /** Set a single OUTPUT pin's logic level.
+ * The bank's other pins are taken from the output shadow register, so this
+ * is a single byte write rather than a read-modify-write.
  * @param pin Which pin to write (0-23)
  * @param value New pin output logic level (0 or 1)
  */
 void TCA6424A::writePin(uint16_t pin, bool value) {
-    I2Cdev::writeBit(devAddr, TCA6424A_RA_OUTPUT0 + (pin / 8), pin % 8, value);
+    uint8_t bank = pin / 8;
+    if (value) outputShadow[bank] |= (1 << (pin % 8));
+    else outputShadow[bank] &= ~(1 << (pin % 8));
+    I2Cdev::writeByte(devAddr, TCA6424A_RA_OUTPUT0 + bank, outputShadow[bank]);
 }
 /** Set all OUTPUT pins' logic levels in one bank.
  * @param bank Which bank to write (0/1/2 for P0*, P1*, P2* respectively)
  * @param value New pins' output logic level (0 or 1 for each pin)
  */
 void TCA6424A::writeBank(uint8_t bank, uint8_t value) {
+    outputShadow[bank] = value;
     I2Cdev::writeByte(devAddr, TCA6424A_RA_OUTPUT0 + bank, value);
 }
 /** Set all OUTPUT pins' logic levels in all banks.
  * @param banks All pins' new logic values (P00-P27) in 3-byte array
  */
 void TCA6424A::writeAll(uint8_t *banks) {
+    outputShadow[0] = banks[0];
+    outputShadow[1] = banks[1];
+    outputShadow[2] = banks[2];
     I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, banks);
 }
 /** Set all OUTPUT pins' logic levels in all banks.
@@ -170,10 +186,10 @@ void TCA6424A::writeAll(uint8_t *banks) {
  * @param bank2 Bank 2's new logic values (P20-P27)
  */
 void TCA6424A::writeAll(uint8_t bank0, uint8_t bank1, uint8_t bank2) {
-    buffer[0] = bank0;
-    buffer[1] = bank1;
-    buffer[2] = bank2;
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
+    outputShadow[0] = bank0;
+    outputShadow[1] = bank1;
+    outputShadow[2] = bank2;
+    I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, outputShadow);
 }
 
 // POLARITY* registers (x8h - xAh)
@@ -281,23 +297,32 @@ void TCA6424A::getAllDirection(uint8_t *bank0, uint8_t *bank1, uint8_t *bank2) {
     *bank2 = buffer[2];
 }
 /** Set a single pin's direction (I/O) setting.
+ * The bank's other pins are taken from the direction shadow register, so
+ * this is a single byte write rather than a read-modify-write.
  * @param pin Which pin to write (0-23)
  * @param direction Pin direction setting (0 or 1)
  */
 void TCA6424A::setPinDirection(uint16_t pin, bool direction) {
-    I2Cdev::writeBit(devAddr, TCA6424A_RA_CONFIG0 + (pin / 8), pin % 8, direction);
+    uint8_t bank = pin / 8;
+    if (direction) directionShadow[bank] |= (1 << (pin % 8));
+    else directionShadow[bank] &= ~(1 << (pin % 8));
+    I2Cdev::writeByte(devAddr, TCA6424A_RA_CONFIG0 + bank, directionShadow[bank]);
 }
 /** Set all pin direction (I/O) settings in one bank.
  * @param bank Which bank to read (0/1/2 for P0*, P1*, P2* respectively)
  * @param direction New pins' direction settings (0 or 1 for each pin)
  */
 void TCA6424A::setBankDirection(uint8_t bank, uint8_t direction) {
+    directionShadow[bank] = direction;
     I2Cdev::writeByte(devAddr, TCA6424A_RA_CONFIG0 + bank, direction);
 }
 /** Set all pin direction (I/O) settings in all banks.
  * @param banks All pins' new direction values (P00-P27) in 3-byte array
  */
 void TCA6424A::setAllDirection(uint8_t *banks) {
+    directionShadow[0] = banks[0];
+    directionShadow[1] = banks[1];
+    directionShadow[2] = banks[2];
     I2Cdev::writeBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, banks);
 }
 /** Set all pin direction (I/O) settings in all banks.
@@ -306,8 +331,75 @@ void TCA6424A::setAllDirection(uint8_t *banks) {
  * @param bank2 Bank 2's new direction values (P20-P27)
  */
 void TCA6424A::setAllDirection(uint8_t bank0, uint8_t bank1, uint8_t bank2) {
-    buffer[0] = bank0;
-    buffer[1] = bank1;
-    buffer[2] = bank2;
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
+    directionShadow[0] = bank0;
+    directionShadow[1] = bank1;
+    directionShadow[2] = bank2;
+    I2Cdev::writeBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, directionShadow);
+}
+
+// shadowed multi-pin updates
+
+/** Reload the output and direction shadow registers from the device.
+ * Only needed if something other than this object changes OUTPUT* or
+ * CONFIG* (another master, or a device reset); initialize() calls it once.
+ */
+void TCA6424A::refreshShadow() {
+    I2Cdev::readBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, outputShadow);
+    I2Cdev::readBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, directionShadow);
+}
+/** Set any subset of the 24 OUTPUT pins at once.
+ * Only the banks whose value actually changes are written, as a single
+ * auto-increment write covering the first through the last of them, so
+ * pins on different banks change in the same transaction.
+ * @param mask Pins to change (bit n = pin n)
+ * @param values New logic levels for the pins in mask
+ */
+void TCA6424A::writeMask(uint32_t mask, uint32_t values) {
+    updateBanks(TCA6424A_RA_OUTPUT0, outputShadow, mask, values);
+}
+/** Invert any subset of the 24 OUTPUT pins at once.
+ * @param mask Pins to toggle (bit n = pin n)
+ * @see writeMask()
+ */
+void TCA6424A::togglePins(uint32_t mask) {
+    updateBanks(TCA6424A_RA_OUTPUT0, outputShadow, mask, ~getOutputShadow());
+}
+/** Set the direction of any subset of the 24 pins at once.
+ * @param mask Pins to change (bit n = pin n)
+ * @param directions New directions for the pins in mask (TCA6424A_OUTPUT or
+ *        TCA6424A_INPUT per bit)
+ * @see writeMask()
+ */
+void TCA6424A::setDirectionMask(uint32_t mask, uint32_t directions) {
+    updateBanks(TCA6424A_RA_CONFIG0, directionShadow, mask, directions);
+}
+/** Get the output levels last written through this object.
+ * @return OUTPUT0-2 shadow (bit n = pin n)
+ */
+uint32_t TCA6424A::getOutputShadow() {
+    return outputShadow[0] | ((uint32_t)outputShadow[1] << 8) | ((uint32_t)outputShadow[2] << 16);
+}
+/** Get the pin directions last written through this object.
+ * @return CONFIG0-2 shadow (bit n = pin n)
+ */
+uint32_t TCA6424A::getDirectionShadow() {
+    return directionShadow[0] | ((uint32_t)directionShadow[1] << 8) | ((uint32_t)directionShadow[2] << 16);
+}
+void TCA6424A::updateBanks(uint8_t regAddr, uint8_t *shadow, uint32_t mask, uint32_t values) {
+    int8_t first = -1, last = -1;
+    for (uint8_t bank = 0; bank < 3; bank++) {
+        uint8_t m = mask >> (bank * 8);
+        uint8_t value = (shadow[bank] & ~m) | ((values >> (bank * 8)) & m);
+        if (value != shadow[bank]) {
+            shadow[bank] = value;
+            if (first < 0) first = bank;
+            last = bank;
+        }
+    }
+    if (first < 0) return;
+    if (first == last) {
+        I2Cdev::writeByte(devAddr, regAddr + first, shadow[first]);
+    } else {
+        I2Cdev::writeBytes(devAddr, (regAddr + first) | TCA6424A_AUTO_INCREMENT, last - first + 1, shadow + first);
+    }
 }
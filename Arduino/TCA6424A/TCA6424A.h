@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - add output/direction shadow registers, writeMask() and togglePins()
 //     2011-07-31 - initial release
 
 /* ============================================
@@ -132,9 +133,21 @@ class TCA6424A {
         void setAllDirection(uint8_t *banks);
         void setAllDirection(uint8_t bank0, uint8_t bank1, uint8_t bank2);
 
+        // shadowed multi-pin updates (bit n of each mask is pin n, 0-23)
+        void refreshShadow();
+        void writeMask(uint32_t mask, uint32_t values);
+        void togglePins(uint32_t mask);
+        void setDirectionMask(uint32_t mask, uint32_t directions);
+        uint32_t getOutputShadow();
+        uint32_t getDirectionShadow();
+
     private:
         uint8_t devAddr;
         uint8_t buffer[3];
+        uint8_t outputShadow[3];    // last value written to OUTPUT0-2
+        uint8_t directionShadow[3]; // last value written to CONFIG0-2
+
+        void updateBanks(uint8_t regAddr, uint8_t *shadow, uint32_t mask, uint32_t values);
 };
 
 #endif /* _TCA6424A_H_ */
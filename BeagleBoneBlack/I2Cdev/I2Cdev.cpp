@@ -5,6 +5,8 @@
 //
 // Changelog:
 //      2018-03-02 - Initial release
+//      2026-10-19 - add I2CdevTransport wireObj routing (see I2CdevScheduler.h)
+//      2026-10-19 - add readBytesAsync/writeBytesAsync with I2CdevRequest completion handles
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -30,16 +32,106 @@ THE SOFTWARE.
 #include <sys/ioctl.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <linux/i2c.h>
 #include <linux/i2c-dev.h>
 #include <stdio.h>
 #include <errno.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
+#include <mutex>
 
 #define OPEN_ERROR_MSG  "Failed to open "
 #define WRITE_ERROR_MSG "Failed to write into "
 #define READ_ERROR_MSG  "Failed to read from "
 
+char I2Cdev::path_[13] = "/dev/i2c-2";
+uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
+
+struct DeviceClock
+{
+    void *wireObj;
+    uint32_t clockHz; // 0 = free entry
+    I2CdevDeviceStats stats;
+    uint8_t devAddr;
+};
+
+// the table is shared by every thread that calls I2Cdev
+static std::mutex deviceClockLock;
+static DeviceClock deviceClocks[I2CDEV_DEVICE_CLOCKS];
+static std::atomic<uint8_t> deviceClockCount(0);
+static uint32_t baseClock = 0;    // from setBusClock(), 0 = left alone
+static uint32_t currentClock = 0; // last clock set on currentWire, 0 = unknown
+static void *currentWire = 0;
+
+static uint64_t nowUs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static DeviceClock *findDevice(uint8_t devAddr, void *wireObj)
+{
+    for (uint8_t i = 0; i < I2CDEV_DEVICE_CLOCKS; i++)
+    {
+        DeviceClock *d = &deviceClocks[i];
+        if (d->clockHz && d->devAddr == devAddr && d->wireObj == wireObj)
+            return d;
+    }
+    return 0;
+}
+
+/** Set the bus clock, unless it is already running at that speed. Only an
+ * I2CdevTransport can switch: the speed of /dev/i2c-N is fixed by the
+ * kernel (device tree clock-frequency), so the default bus just keeps stats.
+ */
+static void applyClock(uint32_t clockHz, void *wireObj)
+{
+    if (!wireObj || (clockHz == currentClock && wireObj == currentWire))
+        return;
+    if (((I2CdevTransport *)wireObj)->setClock(clockHz))
+    {
+        currentClock = clockHz;
+        currentWire = wireObj;
+    }
+}
+
+/** Get the clock for a device's transactions: the bus clock, lowered to
+ * the device's limit if it has a slower one.
+ * @return Clock in Hz, 0 if setBusClock() has not been called
+ */
+static uint32_t deviceClock(DeviceClock *d)
+{
+    return d && d->clockHz < baseClock ? d->clockHz : baseClock;
+}
+
+/** Switch to the clock of the device about to be addressed.
+ * The transport's clock is left alone until setBusClock() has been called.
+ * @return The device's entry, or 0 if it has none
+ */
+static DeviceClock *beginDevice(uint8_t devAddr, void *wireObj)
+{
+    if (!deviceClockCount)
+        return 0;
+    std::lock_guard<std::mutex> guard(deviceClockLock);
+    DeviceClock *d = findDevice(devAddr, wireObj);
+    if (baseClock)
+        applyClock(deviceClock(d), wireObj);
+    return d;
+}
+
+static void endDevice(DeviceClock *d, uint16_t bytes, uint64_t t0)
+{
+    if (!d)
+        return;
+    uint32_t us = nowUs() - t0;
+    std::lock_guard<std::mutex> guard(deviceClockLock);
+    d->stats.transactions++;
+    d->stats.bytes += bytes;
+    d->stats.micros += us;
+}
+
 I2Cdev::I2Cdev() : I2Cdev(DEFAULT_BBB_I2C_BUS) {}
 
 I2Cdev::I2Cdev(uint8_t busAddr)
@@ -53,13 +145,15 @@ I2Cdev::I2Cdev(uint8_t busAddr)
  * @param bitNum Bit position to read (0-7)
  * @param data Container for single bit value
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data)
+int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, void *wireObj)
 {
-    uint8_t b;
-    uint8_t count = readByte(devAddr, regAddr, &b);
-    *data = b & (1 << bitNum);
+    uint8_t b = 0;
+    int8_t count = readByte(devAddr, regAddr, &b, wireObj);
+    if (count > 0)
+        *data = b & (1 << bitNum);
     return count;
 }
 
@@ -69,13 +163,15 @@ int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @param bitNum Bit position to read (0-15)
  * @param data Container for single bit value
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data)
+int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, void *wireObj)
 {
-    uint16_t b;
-    uint8_t count = readWord(devAddr, regAddr, &b);
-    *data = b & (1 << bitNum);
+    uint16_t b = 0;
+    int8_t count = readWord(devAddr, regAddr, &b, wireObj);
+    if (count > 0)
+        *data = b & (1 << bitNum);
     return count;
 }
 
@@ -86,17 +182,19 @@ int8_t I2Cdev::readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16
  * @param length Number of bits to read (not more than 8)
  * @param data Container for right-aligned value (i.e. '101' read from any bitStart position will equal 0x05)
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data)
+int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, void *wireObj)
 {
     // 01101001 read byte
     // 76543210 bit numbers
     //    xxx   args: bitStart=4, length=3
     //    010   masked
     //   -> 010 shifted
-    uint8_t count, b;
-    if ((count = readByte(devAddr, regAddr, &b)) != 0)
+    int8_t count;
+    uint8_t b = 0;
+    if ((count = readByte(devAddr, regAddr, &b, wireObj)) > 0)
     {
         uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         b &= mask;
@@ -113,18 +211,19 @@ int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
  * @param length Number of bits to read (not more than 16)
  * @param data Container for right-aligned value (i.e. '101' read from any bitStart position will equal 0x05)
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of read operation (1 = success, 0 = failure, -1 = timeout)
  */
-int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data)
+int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, void *wireObj)
 {
     // 1101011001101001 read byte
     // fedcba9876543210 bit numbers
     //    xxx           args: bitStart=12, length=3
-    //    010           masked#include <errno.h>
+    //    010           masked
     //           -> 010 shifted
-    uint8_t count;
-    uint16_t w;
-    if ((count = readWord(devAddr, regAddr, &w)) != 0)
+    int8_t count;
+    uint16_t w = 0;
+    if ((count = readWord(devAddr, regAddr, &w, wireObj)) > 0)
     {
         uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         w &= mask;
@@ -139,11 +238,12 @@ int8_t I2Cdev::readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uin
  * @param regAddr Register regAddr to read from
  * @param data Container for byte value read from device
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data)
+int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, void *wireObj)
 {
-    return readBytes(devAddr, regAddr, 1, data);
+    return readBytes(devAddr, regAddr, 1, data, wireObj);
 }
 
 /** Read single word from a 16-bit device register.
@@ -151,11 +251,12 @@ int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data)
  * @param regAddr Register regAddr to read from
  * @param data Container for word value read from device
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data)
+int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, void *wireObj)
 {
-    return readWords(devAddr, regAddr, 1, data);
+    return readWords(devAddr, regAddr, 1, data, wireObj);
 }
 
 /** Read multiple bytes from an 8-bit device register.
@@ -164,12 +265,27 @@ int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data)
  * @param length Number of bytes to read
  * @param data Buffer to store read data in
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Number of bytes read (-1 indicates failure)
  */
-int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data)
+int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj)
+{
+    DeviceClock *device = beginDevice(devAddr, wireObj);
+    uint64_t t0 = device ? nowUs() : 0;
+    int8_t count = transferRead(devAddr, regAddr, length, data, wireObj);
+    endDevice(device, count > 0 ? count : 0, t0);
+    return count;
+}
+
+int8_t I2Cdev::transferRead(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj)
 {
     int fd;
 
+    if (wireObj)
+    {
+        return ((I2CdevTransport *)wireObj)->transfer(devAddr, &regAddr, 1, data, length) ? length : -1;
+    }
+
     if ((fd = open(path_, O_RDWR)) < 0)
     {
         char error_msg[sizeof(OPEN_ERROR_MSG) + sizeof(path_)] = OPEN_ERROR_MSG;
@@ -205,27 +321,89 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
 }
 
 /** Read multiple words from a 16-bit device register.
+ * Reads in chunks of up to I2CDEVLIB_WIRE_BUFFER_LENGTH / 2 words, since
+ * readBytes() counts in int8_t.
  * @param devAddr I2C slave device address
  * @param regAddr First register regAddr to read from
- * @param length Number of words to read
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of words to read (at most 127, so the count fits the return value)
  * @param data Buffer to store read data in
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return Number of words read (-1 indicates failure)
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
+ * @return Number of words read (-1 indicates failure or a length above 127)
  */
-int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data)
+int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj)
 {
-    uint8_t buff[length * 2];
+    const uint8_t chunk = I2CDEVLIB_WIRE_BUFFER_LENGTH / 2;
+    uint8_t buff[chunk * 2];
+
+    if (length > 127)
+        return -1;
+    for (uint8_t k = 0; k < length;)
+    {
+        uint8_t n = length - k < chunk ? length - k : chunk;
+        if (readBytes(devAddr, regAddr + k * 2, n * 2, buff, wireObj) != n * 2)
+            return -1;
+        for (uint8_t i = 0; i < n; i++)
+        {
+            data[k + i] = (buff[i * 2] << 8) | buff[i * 2 + 1];
+        }
+        k += n;
+    }
+    return length;
+}
 
-    if (readBytes(devAddr, regAddr, length * 2, buff) > 0)
+/** Read a run of bytes from a single data port register (e.g. MPU6050 FIFO_R_W).
+ * The register address write and the whole read are one I2C_RDWR ioctl (or
+ * one I2CdevTransport transfer) joined by a repeated start, so there is a
+ * single address phase and no 255 byte limit.
+ * @param devAddr I2C slave device address
+ * @param regAddr Data port register to read from
+ * @param length Number of bytes to read (at most 32767, so the count fits the return value)
+ * @param data Buffer to store read data in
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
+ * @return Number of bytes read (-1 indicates failure or a length above 32767)
+ */
+int16_t I2Cdev::readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, void *wireObj)
+{
+    if (length > 32767)
+        return -1;
+
+    DeviceClock *device = beginDevice(devAddr, wireObj);
+    uint64_t t0 = device ? nowUs() : 0;
+    bool ok;
+
+    if (wireObj)
     {
-        for (int i = 0; i < length; i++)
+        ok = ((I2CdevTransport *)wireObj)->transfer(devAddr, &regAddr, 1, data, length);
+    }
+    else
+    {
+        int fd;
+        struct i2c_msg msgs[2] = {
+            { devAddr, 0, 1, &regAddr },
+            { devAddr, I2C_M_RD, length, data },
+        };
+        struct i2c_rdwr_ioctl_data rdwr = { msgs, 2 };
+
+        if ((fd = open(path_, O_RDWR)) < 0)
+        {
+            char error_msg[sizeof(OPEN_ERROR_MSG) + sizeof(path_)] = OPEN_ERROR_MSG;
+
+            perror(strcat(error_msg, path_));
+            return -1;
+        }
+        ok = ioctl(fd, I2C_RDWR, &rdwr) >= 0;
+        if (!ok)
         {
-            data[i] = (buff[i * 2] << 8) | buff[i * 2 + 1];
+            fprintf(stderr, "Failed to stream from slave at %u address. %s\n", devAddr, strerror(errno));
         }
-        return length;
+        close(fd);
     }
 
-    return -1;
+    endDevice(device, ok ? length : 0, t0);
+    return ok ? length : -1;
 }
 
 /** write a single bit in an 8-bit device register.
@@ -233,14 +411,16 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
  * @param regAddr Register regAddr to write to
  * @param bitNum Bit position to write (0-7)
  * @param value New bit value to write
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data)
+bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data, void *wireObj)
 {
-    uint8_t b;
-    readByte(devAddr, regAddr, &b);
+    uint8_t b = 0;
+    if (readByte(devAddr, regAddr, &b, wireObj) <= 0)
+        return false;
     b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
-    return writeByte(devAddr, regAddr, b);
+    return writeByte(devAddr, regAddr, b, wireObj);
 }
 
 /** write a single bit in a 16-bit device register.
@@ -248,14 +428,16 @@ bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @param regAddr Register regAddr to write to
  * @param bitNum Bit position to write (0-15)
  * @param value New bit value to write
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data)
+bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data, void *wireObj)
 {
-    uint16_t w;
-    readWord(devAddr, regAddr, &w);
+    uint16_t w = 0;
+    if (readWord(devAddr, regAddr, &w, wireObj) <= 0)
+        return false;
     w = (data != 0) ? (w | (1 << bitNum)) : (w & ~(1 << bitNum));
-    return writeWord(devAddr, regAddr, w);
+    return writeWord(devAddr, regAddr, w, wireObj);
 }
 
 /** Write multiple bits in an 8-bit device register.
@@ -264,9 +446,10 @@ bool I2Cdev::writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_
  * @param bitStart First bit position to write (0-7)
  * @param length Number of bits to write (not more than 8)
  * @param data Right-aligned value to write
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data)
+bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data, void *wireObj)
 {
     //      010 value to write
     // 76543210 bit numbers
@@ -275,15 +458,36 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
     // 10101111 original value (sample)
     // 10100011 original & ~mask
     // 10101011 masked | value
-    uint8_t b;
-    if (readByte(devAddr, regAddr, &b) != 0)
+    uint8_t b = 0;
+    if (readByte(devAddr, regAddr, &b, wireObj) > 0)
     {
         uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         data <<= (bitStart - length + 1); // shift data into correct position
         data &= mask;                     // zero all non-important bits in data
         b &= ~(mask);                     // zero all important bits in existing byte
         b |= data;                        // combine data with existing byte
-        return writeByte(devAddr, regAddr, b);
+        return writeByte(devAddr, regAddr, b, wireObj);
+    }
+    else
+    {
+        return false;
+    }
+}
+
+/** Write the bits selected by a mask in an 8-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param mask Bits to replace, already in position
+ * @param data New register value, only the bits in mask are used
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data, void *wireObj)
+{
+    uint8_t b = 0;
+    if (readByte(devAddr, regAddr, &b, wireObj) > 0)
+    {
+        return writeByte(devAddr, regAddr, (b & ~mask) | (data & mask), wireObj);
     }
     else
     {
@@ -297,9 +501,10 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
  * @param bitStart First bit position to write (0-15)
  * @param length Number of bits to write (not more than 16)
  * @param data Right-aligned value to write
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data)
+bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data, void *wireObj)
 {
     //              010 value to write
     // fedcba9876543210 bit numbers
@@ -308,15 +513,15 @@ bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
     // 1010111110010110 original value (sample)
     // 1010001110010110 original & ~mask
     // 1010101110010110 masked | value
-    uint16_t w;
-    if (readWord(devAddr, regAddr, &w) != 0)
+    uint16_t w = 0;
+    if (readWord(devAddr, regAddr, &w, wireObj) > 0)
     {
         uint16_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         data <<= (bitStart - length + 1); // shift data into correct position
         data &= mask;                     // zero all non-important bits in data
         w &= ~(mask);                     // zero all important bits in existing word
         w |= data;                        // combine data with existing word
-        return writeWord(devAddr, regAddr, w);
+        return writeWord(devAddr, regAddr, w, wireObj);
     }
     else
     {
@@ -328,22 +533,24 @@ bool I2Cdev::writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
  * @param devAddr I2C slave device address
  * @param regAddr Register address to write to
  * @param data New byte value to write
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data)
+bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data, void *wireObj)
 {
-    return writeBytes(devAddr, regAddr, 1, &data);
+    return writeBytes(devAddr, regAddr, 1, &data, wireObj);
 }
 
 /** Write single word to a 16-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register address to write to
  * @param data New word value to write
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data)
+bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data, void *wireObj)
 {
-    return writeWords(devAddr, regAddr, 1, &data);
+    return writeWords(devAddr, regAddr, 1, &data, wireObj);
 }
 
 /** Write multiple bytes to an 8-bit device register.
@@ -351,12 +558,30 @@ bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data)
  * @param regAddr First register address to write to
  * @param length Number of bytes to write
  * @param data Buffer to copy new data from
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data)
+bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj)
+{
+    DeviceClock *device = beginDevice(devAddr, wireObj);
+    uint64_t t0 = device ? nowUs() : 0;
+    bool ok = transferWrite(devAddr, regAddr, length, data, wireObj);
+    endDevice(device, ok ? length : 0, t0);
+    return ok;
+}
+
+bool I2Cdev::transferWrite(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj)
 {
     int fd;
 
+    if (wireObj)
+    {
+        uint8_t buff[length + 1];
+        buff[0] = regAddr;
+        memcpy(&buff[1], data, length);
+        return ((I2CdevTransport *)wireObj)->transfer(devAddr, buff, length + 1, 0, 0);
+    }
+
     if ((fd = open(path_, O_RDWR)) < 0)
     {
         char error_msg[sizeof(OPEN_ERROR_MSG) + sizeof(path_)] = OPEN_ERROR_MSG;
@@ -395,9 +620,10 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
  * @param regAddr First register address to write to
  * @param length Number of words to write
  * @param data Buffer to copy new data from
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data)
+bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj)
 {
     uint8_t buff[length * 2];
 
@@ -407,5 +633,202 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
         buff[1 + 2 * i] = (uint8_t)(data[i] >> 0); //LSByte
     }
 
-    return writeBytes(devAddr, regAddr, length * 2, buff);
+    return writeBytes(devAddr, regAddr, length * 2, buff, wireObj);
+}
+
+/** Start reading multiple bytes from an 8-bit device register without
+ * waiting for the transfer. With a queued transport (e.g. an I2CdevClient)
+ * the call returns at once and the caller can work on other data until
+ * I2Cdev::wait() or the request callback reports completion; with no
+ * wireObj or a synchronous transport the read completes before returning.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read
+ * @param data Buffer to store read data in, must stay valid until completion
+ * @param request Completion handle, must stay valid until completion
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
+ * @return Status of submission (true = started, false = rejected; the request is
+ *         then no longer pending and its callback does not run)
+ */
+bool I2Cdev::readBytesAsync(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, I2CdevRequest *request, void *wireObj)
+{
+    request->devAddr = devAddr;
+    request->buffer[0] = regAddr;
+    request->writeData = request->buffer;
+    request->writeLength = 1;
+    request->readData = data;
+    request->readLength = length;
+    request->status.store(I2CDEV_REQUEST_PENDING, std::memory_order_relaxed);
+
+    if (!wireObj)
+    {
+        I2CdevTransport::complete(request, readBytes(devAddr, regAddr, length, data) != -1);
+        return true;
+    }
+    if (!((I2CdevTransport *)wireObj)->submit(request))
+    {
+        request->status.store(I2CDEV_REQUEST_DONE, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+/** Start writing multiple bytes to an 8-bit device register without waiting
+ * for the transfer. The data is copied into the request, so the caller's
+ * buffer may be reused at once.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write (at most I2CDEV_REQUEST_BUFFER_SIZE - 1)
+ * @param data Buffer to copy new data from
+ * @param request Completion handle, must stay valid until completion
+ * @param wireObj I2CdevTransport to route the transaction through (0 for the default bus device)
+ * @return Status of submission (true = started, false = rejected; the request is
+ *         then no longer pending and its callback does not run)
+ */
+bool I2Cdev::writeBytesAsync(uint8_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data, I2CdevRequest *request, void *wireObj)
+{
+    if (length > I2CDEV_REQUEST_BUFFER_SIZE - 1)
+        return false;
+
+    request->devAddr = devAddr;
+    request->buffer[0] = regAddr;
+    memcpy(&request->buffer[1], data, length);
+    request->writeData = request->buffer;
+    request->writeLength = length + 1;
+    request->readData = 0;
+    request->readLength = 0;
+    request->status.store(I2CDEV_REQUEST_PENDING, std::memory_order_relaxed);
+
+    if (!wireObj)
+    {
+        I2CdevTransport::complete(request, writeBytes(devAddr, regAddr, length, &request->buffer[1]));
+        return true;
+    }
+    if (!((I2CdevTransport *)wireObj)->submit(request))
+    {
+        request->status.store(I2CDEV_REQUEST_DONE, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+/** Block until an asynchronous transaction has completed.
+ * @param request Completion handle passed to readBytesAsync/writeBytesAsync
+ * @param wireObj Same wireObj the request was started on
+ * @return Number of bytes read (or written), -1 indicates failure
+ */
+int16_t I2Cdev::wait(I2CdevRequest *request, void *wireObj)
+{
+    if (wireObj)
+        ((I2CdevTransport *)wireObj)->wait(request);
+    if (request->getStatus() != I2CDEV_REQUEST_DONE)
+        return -1;
+    return request->readLength ? request->readLength : request->writeLength - 1;
+}
+
+/** Set the fastest bus clock a device supports.
+ * Once setBusClock() has been called, the transport is lowered to this clock
+ * before each of the device's transactions routed through an I2CdevTransport
+ * and restored to the bus clock for everyone else; a limit above the bus
+ * clock is never applied. /dev/i2c-N runs at the
+ * speed the kernel configured, so there the entry only enables the traffic
+ * counters, see getDeviceStats().
+ * @param devAddr I2C slave device address
+ * @param clockHz Maximum clock in Hz (0 to remove the device's entry)
+ * @param wireObj Transport the device is on (0 for the default bus device)
+ * @return True if the entry was stored, false if the table is full
+ *         (I2CDEV_DEVICE_CLOCKS entries)
+ */
+bool I2Cdev::setDeviceClock(uint8_t devAddr, uint32_t clockHz, void *wireObj)
+{
+    std::lock_guard<std::mutex> guard(deviceClockLock);
+    DeviceClock *d = findDevice(devAddr, wireObj);
+    if (!clockHz)
+    {
+        if (d)
+        {
+            d->clockHz = 0;
+            deviceClockCount--;
+        }
+        return true;
+    }
+    if (!d)
+    {
+        for (uint8_t i = 0; !d && i < I2CDEV_DEVICE_CLOCKS; i++)
+        {
+            if (!deviceClocks[i].clockHz)
+                d = &deviceClocks[i];
+        }
+        if (!d)
+            return false;
+        d->devAddr = devAddr;
+        d->wireObj = wireObj;
+        deviceClockCount++;
+    }
+    d->clockHz = clockHz;
+    memset(&d->stats, 0, sizeof(d->stats));
+    return true;
+}
+
+/** Get the clock used for a device's transactions.
+ * @param devAddr I2C slave device address
+ * @param wireObj Transport the device is on (0 for the default bus device)
+ * @return Bus clock in Hz, or the device's limit from setDeviceClock() if that
+ *         is lower; 0 if transport clocks are left alone (no setBusClock() yet)
+ */
+uint32_t I2Cdev::getDeviceClock(uint8_t devAddr, void *wireObj)
+{
+    std::lock_guard<std::mutex> guard(deviceClockLock);
+    return deviceClock(findDevice(devAddr, wireObj));
+}
+
+/** Set the bus clock, which registered devices are only ever slowed down
+ * from, and switch a transport to it.
+ * @param clockHz Clock in Hz (0 to leave transport clocks alone again)
+ * @param wireObj Transport to switch now (0 for none)
+ */
+void I2Cdev::setBusClock(uint32_t clockHz, void *wireObj)
+{
+    std::lock_guard<std::mutex> guard(deviceClockLock);
+    baseClock = clockHz;
+    currentClock = 0;
+    if (clockHz)
+        applyClock(clockHz, wireObj);
+}
+
+/** Get a registered device's traffic since setDeviceClock() or resetDeviceStats().
+ * @param devAddr I2C slave device address
+ * @param stats Receives a copy of the counters
+ * @param wireObj Transport the device is on (0 for the default bus device)
+ * @return False if the device has no setDeviceClock() entry
+ */
+bool I2Cdev::getDeviceStats(uint8_t devAddr, I2CdevDeviceStats *stats, void *wireObj)
+{
+    std::lock_guard<std::mutex> guard(deviceClockLock);
+    DeviceClock *d = findDevice(devAddr, wireObj);
+    if (!d)
+        return false;
+    *stats = d->stats;
+    return true;
+}
+
+/** Get the data rate a registered device achieved while it had the bus.
+ * @param devAddr I2C slave device address
+ * @param wireObj Transport the device is on (0 for the default bus device)
+ * @return Bytes per second of transaction time (0 if unknown)
+ */
+uint32_t I2Cdev::getDeviceThroughput(uint8_t devAddr, void *wireObj)
+{
+    I2CdevDeviceStats stats;
+    if (!getDeviceStats(devAddr, &stats, wireObj) || !stats.micros)
+        return 0;
+    return (uint64_t)stats.bytes * 1000000 / stats.micros;
+}
+
+/** Clear the traffic counters of every registered device. */
+void I2Cdev::resetDeviceStats()
+{
+    std::lock_guard<std::mutex> guard(deviceClockLock);
+    for (uint8_t i = 0; i < I2CDEV_DEVICE_CLOCKS; i++)
+        memset(&deviceClocks[i].stats, 0, sizeof(deviceClocks[i].stats));
 }
@@ -5,6 +5,12 @@
 //
 // Changelog:
 //      2018-03-02 - Initial release
+//      2026-10-19 - add I2CdevTransport wireObj routing (see I2CdevScheduler.h)
+//      2026-10-19 - add readBytesAsync/writeBytesAsync with I2CdevRequest completion handles
+//      2026-10-19 - add Arduino-style timeout overloads, readTimeout and writeMasked() so the
+//                   shared Arduino/MPU6050 core builds against this port (see I2CdevPort.h)
+//      2026-10-19 - add readStream() for long reads from data port registers
+//      2026-10-19 - add per-device clock table and traffic counters (setDeviceClock, getDeviceStats)
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -30,35 +36,177 @@ THE SOFTWARE.
 #define _I2CDEV_H_
 
 #include <stdint.h>
+#include <atomic>
+#include <thread>
 
 #define DEFAULT_BBB_I2C_BUS 2
 
+#define I2CDEV_REQUEST_FAILED   -1
+#define I2CDEV_REQUEST_PENDING  0
+#define I2CDEV_REQUEST_DONE     1
+
+#define I2CDEV_REQUEST_BUFFER_SIZE 33 // register address + up to 32 bytes for writeBytesAsync
+
+// kept for source compatibility with the Arduino I2Cdev, i2c-dev applies its own timeout
+#define I2CDEV_DEFAULT_READ_TIMEOUT 1000
+// largest single read the shared drivers should issue; i2c-dev has no Wire-style
+// buffer, but readBytes() returns the count as int8_t
+#define I2CDEVLIB_WIRE_BUFFER_LENGTH 127
+
+#define I2CDEV_DEVICE_CLOCKS 8
+
+/** Traffic of one device registered with I2Cdev::setDeviceClock(). */
+struct I2CdevDeviceStats
+{
+  uint32_t transactions;
+  uint32_t bytes;  // payload bytes moved, register addresses not included
+  uint32_t micros; // time spent in its transactions
+};
+
+class I2CdevRequest;
+typedef void (*I2CdevCallback)(I2CdevRequest *request, void *arg);
+
+/** Completion handle of one asynchronous transaction. The caller owns it
+ * and must keep it (and the data buffer) alive until it has completed;
+ * poll isDone(), block in I2Cdev::wait(), or set a callback. The backend
+ * fields at the end are reserved for the transport that runs it.
+ */
+class I2CdevRequest
+{
+public:
+  I2CdevRequest() : callback(0), callbackArg(0), status(I2CDEV_REQUEST_DONE) {}
+
+  bool isDone() { return status.load(std::memory_order_acquire) != I2CDEV_REQUEST_PENDING; }
+  int8_t getStatus() { return status.load(std::memory_order_acquire); }
+  void setCallback(I2CdevCallback cb, void *arg = 0) { callback = cb; callbackArg = arg; }
+
+  uint8_t devAddr;
+  const uint8_t *writeData;
+  uint16_t writeLength;
+  uint8_t *readData;
+  uint16_t readLength;
+  uint8_t buffer[I2CDEV_REQUEST_BUFFER_SIZE];
+  I2CdevCallback callback; // runs on the completing thread (or inline), keep it short
+  void *callbackArg;
+  std::atomic<int8_t> status;
+
+  // backend bookkeeping
+  void *owner;
+  uint8_t priority;
+  uint64_t submitted;
+  uint64_t deadline;
+};
+
+/** Target of a complete I2C transaction: write writeLength bytes, then
+ * (with a repeated start) read readLength bytes. Either length may be 0.
+ * Pass a pointer to any implementation as the wireObj argument of an I2Cdev
+ * method to route the transaction through it instead of opening the default
+ * bus device; see I2CdevScheduler.h for the implementations.
+ *
+ * submit() starts a transaction without waiting for it. The default runs it
+ * synchronously and completes the request before returning, so every
+ * transport supports the async API; queued or interrupt-driven transports
+ * override submit() and wait() to overlap the transfer with the caller;
+ * the default wait() yields the CPU until the request is done.
+ */
+class I2CdevTransport
+{
+public:
+  virtual ~I2CdevTransport() {}
+  virtual bool transfer(uint8_t devAddr, const uint8_t *writeData, uint16_t writeLength,
+                        uint8_t *readData, uint16_t readLength) = 0;
+
+  virtual bool submit(I2CdevRequest *request)
+  {
+    bool ok = transfer(request->devAddr, request->writeData, request->writeLength,
+                       request->readData, request->readLength);
+    complete(request, ok);
+    return true;
+  }
+  virtual void wait(I2CdevRequest *request)
+  {
+    while (!request->isDone())
+      std::this_thread::yield();
+  }
+
+  /** Change the SCL clock for the following transactions. Called by I2Cdev
+   * when consecutive transactions address devices with different
+   * setDeviceClock() limits. The default cannot switch and returns false.
+   */
+  virtual bool setClock(uint32_t /*clockHz*/) { return false; }
+
+  /** Finish a request. The callback is read before the status is published,
+   * because the owner may release the request as soon as it sees the status
+   * (I2CdevClient::transfer() keeps its request on the stack); the request
+   * is not touched here afterwards. A callback on a request that someone
+   * also waits on must therefore not dereference the request either.
+   */
+  static void complete(I2CdevRequest *request, bool ok)
+  {
+    I2CdevCallback callback = request->callback;
+    void *callbackArg = request->callbackArg;
+    request->status.store(ok ? I2CDEV_REQUEST_DONE : I2CDEV_REQUEST_FAILED, std::memory_order_release);
+    if (callback)
+      callback(request, callbackArg);
+  }
+};
+
 class I2Cdev
 {
 public:
   I2Cdev();
   I2Cdev(uint8_t busAddr);
 
-  static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data);
-  static int8_t readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data);
-  static int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data);
-  static int8_t readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data);
-  static int8_t readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data);
-  static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data);
-  static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
-  static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
-
-  static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
-  static bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
-  static bool writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data);
-  static bool writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data);
-  static bool writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data);
-  static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
-  static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
-  static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+  static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, void *wireObj=0);
+  static int8_t readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, void *wireObj=0);
+  static int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, void *wireObj=0);
+  static int8_t readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, void *wireObj=0);
+  static int8_t readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, void *wireObj=0);
+  static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, void *wireObj=0);
+  static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj=0);
+  static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj=0);
+  static int16_t readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, void *wireObj=0);
+
+  static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data, void *wireObj=0);
+  static bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data, void *wireObj=0);
+  static bool writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data, void *wireObj=0);
+  static bool writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data, void *wireObj=0);
+  static bool writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data, void *wireObj=0);
+  static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data, void *wireObj=0);
+  static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj=0);
+  static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj=0);
+
+  static bool readBytesAsync(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, I2CdevRequest *request, void *wireObj=0);
+  static bool writeBytesAsync(uint8_t devAddr, uint8_t regAddr, uint8_t length, const uint8_t *data, I2CdevRequest *request, void *wireObj=0);
+  static int16_t wait(I2CdevRequest *request, void *wireObj=0);
+
+  static bool writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data, void *wireObj=0);
+
+  static bool setDeviceClock(uint8_t devAddr, uint32_t clockHz, void *wireObj=0);
+  static uint32_t getDeviceClock(uint8_t devAddr, void *wireObj=0);
+  static void setBusClock(uint32_t clockHz, void *wireObj=0);
+  static bool getDeviceStats(uint8_t devAddr, I2CdevDeviceStats *stats, void *wireObj=0);
+  static uint32_t getDeviceThroughput(uint8_t devAddr, void *wireObj=0);
+  static void resetDeviceStats();
+
+  // Arduino I2Cdev signatures, used by the shared drivers in the Arduino tree; timeout is ignored
+  static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t /*timeout*/, void *wireObj) { return readBit(devAddr, regAddr, bitNum, data, wireObj); }
+  static int8_t readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t /*timeout*/, void *wireObj) { return readBitW(devAddr, regAddr, bitNum, data, wireObj); }
+  static int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t /*timeout*/, void *wireObj) { return readBits(devAddr, regAddr, bitStart, length, data, wireObj); }
+  static int8_t readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data, uint16_t /*timeout*/, void *wireObj) { return readBitsW(devAddr, regAddr, bitStart, length, data, wireObj); }
+  static int8_t readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t /*timeout*/, void *wireObj) { return readByte(devAddr, regAddr, data, wireObj); }
+  static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t /*timeout*/, void *wireObj) { return readWord(devAddr, regAddr, data, wireObj); }
+  static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t /*timeout*/, void *wireObj) { return readBytes(devAddr, regAddr, length, data, wireObj); }
+  static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t /*timeout*/, void *wireObj) { return readWords(devAddr, regAddr, length, data, wireObj); }
+  static int16_t readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t /*timeout*/, void *wireObj) { return readStream(devAddr, regAddr, length, data, wireObj); }
+
+  static uint16_t readTimeout;
 
 private:
-  char path_[13]; // up to "/dev/i2c-255"
+  static int8_t transferRead(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj);
+  static bool transferWrite(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj);
+
+  static char path_[13]; // up to "/dev/i2c-255"
 };
 
 #endif /* _I2CDEV_H_ */
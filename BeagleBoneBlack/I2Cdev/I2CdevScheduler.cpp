@@ -0,0 +1,586 @@
+// I2Cdev library collection - per-bus transaction scheduler for Linux hosts
+// One thread owns each /dev/i2c-N file descriptor and serves transactions
+// submitted by any number of client threads, most urgent first
+// Based on Arduino's I2Cdev by Jeff Rowberg <jeff@rowberg.net>
+//
+// Changelog:
+//      2026-10-19 - Initial release
+//      2026-10-19 - asynchronous submission through I2CdevClient::submit()
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "I2CdevScheduler.h"
+#include <sys/ioctl.h>
+#include <sys/eventfd.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+#define OPEN_ERROR_MSG  "Failed to open "
+
+// ============================================================================
+// I2CdevLinuxTransport
+// ============================================================================
+
+I2CdevLinuxTransport::I2CdevLinuxTransport(uint8_t busAddr) : fd_(-1)
+{
+    sprintf(path_, "/dev/i2c-%hhu", busAddr);
+}
+
+I2CdevLinuxTransport::~I2CdevLinuxTransport()
+{
+    end();
+}
+
+/** Open the bus device.
+ * @return Status of operation (true = success)
+ */
+bool I2CdevLinuxTransport::begin()
+{
+    if (fd_ >= 0)
+        return true;
+
+    if ((fd_ = open(path_, O_RDWR)) < 0)
+    {
+        char error_msg[sizeof(OPEN_ERROR_MSG) + sizeof(path_)] = OPEN_ERROR_MSG;
+
+        perror(strcat(error_msg, path_));
+        return false;
+    }
+    return true;
+}
+
+/** Close the bus device. */
+void I2CdevLinuxTransport::end()
+{
+    if (fd_ >= 0)
+    {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+
+/** Run one combined write/read transaction with a single I2C_RDWR ioctl.
+ * @param devAddr I2C slave device address
+ * @param writeData Bytes to write (usually the register address first)
+ * @param writeLength Number of bytes to write (0 for a plain read)
+ * @param readData Buffer to store read data in
+ * @param readLength Number of bytes to read after a repeated start (0 for a plain write)
+ * @return Status of operation (true = success)
+ */
+bool I2CdevLinuxTransport::transfer(uint8_t devAddr, const uint8_t *writeData, uint16_t writeLength,
+                                    uint8_t *readData, uint16_t readLength)
+{
+    struct i2c_msg msgs[2];
+    struct i2c_rdwr_ioctl_data rdwr;
+
+    rdwr.msgs = msgs;
+    rdwr.nmsgs = 0;
+    if (writeLength)
+    {
+        msgs[rdwr.nmsgs].addr = devAddr;
+        msgs[rdwr.nmsgs].flags = 0;
+        msgs[rdwr.nmsgs].len = writeLength;
+        msgs[rdwr.nmsgs].buf = (uint8_t *)writeData;
+        rdwr.nmsgs++;
+    }
+    if (readLength)
+    {
+        msgs[rdwr.nmsgs].addr = devAddr;
+        msgs[rdwr.nmsgs].flags = I2C_M_RD;
+        msgs[rdwr.nmsgs].len = readLength;
+        msgs[rdwr.nmsgs].buf = readData;
+        rdwr.nmsgs++;
+    }
+    if (rdwr.nmsgs == 0)
+        return true;
+
+    if (fd_ < 0 && !begin())
+        return false;
+
+    if (ioctl(fd_, I2C_RDWR, &rdwr) < 0)
+    {
+        fprintf(stderr, "I2C transfer to slave at %u address on %s failed. %s\n", devAddr, path_, strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// I2CdevSimTransport
+// ============================================================================
+
+I2CdevSimTransport::I2CdevSimTransport(uint32_t clockHz) : clockHz_(clockHz), transfers_(0)
+{
+    memset(delayUs_, 0, sizeof(delayUs_));
+    memset(pointer_, 0, sizeof(pointer_));
+    memset(registers_, 0, sizeof(registers_));
+}
+
+/** Set the simulated SCL clock.
+ * @param clockHz Bus clock in Hz (100000 standard mode, 400000 fast mode)
+ */
+bool I2CdevSimTransport::setClock(uint32_t clockHz)
+{
+    clockHz_ = clockHz;
+    return true;
+}
+
+/** Add a fixed delay to every transaction with one device.
+ * @param devAddr I2C slave device address
+ * @param delayUs Extra time per transaction in microseconds
+ */
+void I2CdevSimTransport::setDeviceDelay(uint8_t devAddr, uint32_t delayUs)
+{
+    delayUs_[devAddr & 0x7F] = delayUs;
+}
+
+void I2CdevSimTransport::setRegister(uint8_t devAddr, uint8_t regAddr, uint8_t value)
+{
+    registers_[devAddr & 0x7F][regAddr] = value;
+}
+
+uint8_t I2CdevSimTransport::getRegister(uint8_t devAddr, uint8_t regAddr)
+{
+    return registers_[devAddr & 0x7F][regAddr];
+}
+
+uint32_t I2CdevSimTransport::getTransferCount()
+{
+    return transfers_;
+}
+
+/** Run one transaction against the simulated register files, taking as long
+ * as the real bus would. The first written byte sets the register pointer.
+ * @see I2CdevLinuxTransport::transfer()
+ */
+bool I2CdevSimTransport::transfer(uint8_t devAddr, const uint8_t *writeData, uint16_t writeLength,
+                                  uint8_t *readData, uint16_t readLength)
+{
+    uint8_t dev = devAddr & 0x7F;
+    uint64_t start = I2CdevScheduler::now();
+
+    // address byte + data bytes, 9 clocks each, plus start/stop per message
+    uint32_t clocks = 0;
+    if (writeLength)
+        clocks += (1 + writeLength) * 9 + 2;
+    if (readLength)
+        clocks += (1 + readLength) * 9 + 2;
+    uint64_t end = start + (uint64_t)clocks * 1000000000ULL / clockHz_ + delayUs_[dev] * 1000ULL;
+
+    if (writeLength)
+    {
+        pointer_[dev] = writeData[0];
+        for (uint16_t i = 1; i < writeLength; i++)
+            registers_[dev][pointer_[dev]++] = writeData[i];
+    }
+    for (uint16_t i = 0; i < readLength; i++)
+        readData[i] = registers_[dev][pointer_[dev]++];
+    transfers_++;
+
+    // sleep like the i2c-dev driver does, leaving the CPU to other threads
+    struct timespec ts;
+    ts.tv_sec = end / 1000000000ULL;
+    ts.tv_nsec = end % 1000000000ULL;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        ;
+    return true;
+}
+
+// ============================================================================
+// I2CdevScheduler
+// ============================================================================
+
+I2CdevScheduler::I2CdevScheduler(I2CdevTransport *transport)
+    : transport_(transport), pendingCount_(0), policy_(I2CDEV_SCHED_POLICY_PRIORITY), wakeFd_(-1), idle_(false), running_(false)
+{
+    for (uint8_t p = 0; p < I2CDEV_SCHED_PRIORITIES; p++)
+    {
+        for (uint32_t i = 0; i < I2CDEV_SCHED_QUEUE_DEPTH; i++)
+            queues_[p].slots[i].sequence.store(i, std::memory_order_relaxed);
+        queues_[p].head.store(0, std::memory_order_relaxed);
+        queues_[p].tail.store(0, std::memory_order_relaxed);
+    }
+}
+
+I2CdevScheduler::~I2CdevScheduler()
+{
+    stop();
+}
+
+/** Start the bus owner thread.
+ * @return Status of operation (true = success)
+ */
+bool I2CdevScheduler::start()
+{
+    if (running_)
+        return true;
+    if ((wakeFd_ = eventfd(0, EFD_CLOEXEC)) < 0)
+    {
+        perror("Failed to create scheduler eventfd");
+        return false;
+    }
+    running_ = true;
+    thread_ = std::thread(&I2CdevScheduler::run, this);
+    return true;
+}
+
+/** Stop the bus owner thread. Requests still queued complete with a failed
+ * status. Clients must not submit new requests once stop() has been called.
+ */
+void I2CdevScheduler::stop()
+{
+    if (!running_)
+        return;
+    running_ = false;
+    uint64_t one = 1;
+    if (write(wakeFd_, &one, sizeof(one)) < 0)
+        perror("Failed to wake scheduler");
+    thread_.join();
+    close(wakeFd_);
+    wakeFd_ = -1;
+}
+
+bool I2CdevScheduler::isRunning()
+{
+    return running_;
+}
+
+uint8_t I2CdevScheduler::getPolicy()
+{
+    return policy_;
+}
+
+/** Set the order in which pending requests are served. Only change the
+ * policy while the scheduler is stopped.
+ * @param policy I2CDEV_SCHED_POLICY_PRIORITY (default) or I2CDEV_SCHED_POLICY_FIFO
+ */
+void I2CdevScheduler::setPolicy(uint8_t policy)
+{
+    policy_ = policy;
+}
+
+/** Queue a request without taking any lock. Safe to call from any thread,
+ * including request callbacks. The owning client is signalled once it has
+ * completed.
+ * @param request Filled request with an I2CdevClient owner, must stay valid until completion
+ * @return Status of operation (false = queue for this priority is full, request not queued)
+ */
+bool I2CdevScheduler::submit(I2CdevRequest *request)
+{
+    if (!running_)
+    {
+        complete(request, false);
+        return true;
+    }
+
+    uint8_t priority = request->priority < I2CDEV_SCHED_PRIORITIES ? request->priority : I2CDEV_SCHED_PRIORITIES - 1;
+    if (!push(&queues_[priority], request))
+        return false;
+
+    // pairs with the fence in run(): either the scheduler sees the request
+    // on its re-check, or we see it idle and wake it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle_.exchange(false))
+    {
+        uint64_t one = 1;
+        if (write(wakeFd_, &one, sizeof(one)) < 0)
+            perror("Failed to wake scheduler");
+    }
+    return true;
+}
+
+/** Current CLOCK_MONOTONIC time.
+ * @return Time in nanoseconds
+ */
+uint64_t I2CdevScheduler::now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// bounded multi-producer queue, one sequence number per slot
+bool I2CdevScheduler::push(Queue *queue, I2CdevRequest *request)
+{
+    uint32_t pos = queue->head.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Slot *slot = &queue->slots[pos & (I2CDEV_SCHED_QUEUE_DEPTH - 1)];
+        int32_t diff = (int32_t)(slot->sequence.load(std::memory_order_acquire) - pos);
+        if (diff == 0)
+        {
+            if (queue->head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot->request = request;
+                slot->sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = queue->head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// single consumer side, only called from the scheduler thread
+I2CdevRequest *I2CdevScheduler::pop(Queue *queue)
+{
+    uint32_t pos = queue->tail.load(std::memory_order_relaxed);
+    Slot *slot = &queue->slots[pos & (I2CDEV_SCHED_QUEUE_DEPTH - 1)];
+    if ((int32_t)(slot->sequence.load(std::memory_order_acquire) - (pos + 1)) < 0)
+        return 0;
+    I2CdevRequest *request = slot->request;
+    queue->tail.store(pos + 1, std::memory_order_relaxed);
+    slot->sequence.store(pos + I2CDEV_SCHED_QUEUE_DEPTH, std::memory_order_release);
+    return request;
+}
+
+// move everything submitted so far into the pending list
+bool I2CdevScheduler::drain()
+{
+    const uint16_t capacity = sizeof(pending_) / sizeof(pending_[0]);
+    for (uint8_t p = 0; p < I2CDEV_SCHED_PRIORITIES; p++)
+    {
+        I2CdevRequest *request;
+        while (pendingCount_ < capacity && (request = pop(&queues_[p])) != 0)
+            pending_[pendingCount_++] = request;
+    }
+    return pendingCount_ > 0;
+}
+
+void I2CdevScheduler::complete(I2CdevRequest *request, bool status)
+{
+    I2CdevClient *client = (I2CdevClient *)request->owner;
+    uint64_t done = now();
+    client->record(done - request->submitted, status, request->deadline && done > request->deadline);
+    I2CdevTransport::complete(request, status);
+    client->signal();
+}
+
+void I2CdevScheduler::run()
+{
+    while (running_)
+    {
+        if (!drain())
+        {
+            idle_.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!drain())
+            {
+                uint64_t count;
+                if (read(wakeFd_, &count, sizeof(count)) < 0 && errno != EINTR)
+                    perror("Failed to wait for requests");
+            }
+            idle_.store(false);
+            continue;
+        }
+
+        // most urgent: priority, then earliest deadline, then oldest
+        uint16_t best = 0;
+        for (uint16_t i = 1; i < pendingCount_; i++)
+        {
+            I2CdevRequest *a = pending_[i], *b = pending_[best];
+            if (policy_ == I2CDEV_SCHED_POLICY_FIFO)
+            {
+                if (a->submitted < b->submitted)
+                    best = i;
+                continue;
+            }
+            uint64_t da = a->deadline ? a->deadline : UINT64_MAX;
+            uint64_t db = b->deadline ? b->deadline : UINT64_MAX;
+            if (a->priority != b->priority ? a->priority < b->priority
+                                           : da != db ? da < db : a->submitted < b->submitted)
+                best = i;
+        }
+        I2CdevRequest *request = pending_[best];
+        pending_[best] = pending_[--pendingCount_];
+
+        bool status = transport_->transfer(request->devAddr, request->writeData, request->writeLength,
+                                           request->readData, request->readLength);
+        complete(request, status);
+    }
+
+    drain();
+    while (pendingCount_)
+        complete(pending_[--pendingCount_], false);
+}
+
+// ============================================================================
+// I2CdevClient
+// ============================================================================
+
+/** Create a client of a scheduler.
+ * @param scheduler Scheduler owning the bus
+ * @param priority Priority of every request from this client (0 = most urgent)
+ * @param deadlineUs Relative deadline of each request in microseconds (0 = none)
+ * @param name Label for statistics output
+ */
+I2CdevClient::I2CdevClient(I2CdevScheduler *scheduler, uint8_t priority, uint32_t deadlineUs, const char *name)
+    : scheduler_(scheduler), priority_(priority), deadlineUs_(deadlineUs), name_(name ? name : "")
+{
+    if ((doneFd_ = eventfd(0, EFD_CLOEXEC)) < 0)
+        perror("Failed to create client eventfd");
+    resetStats();
+}
+
+I2CdevClient::~I2CdevClient()
+{
+    if (doneFd_ >= 0)
+        close(doneFd_);
+}
+
+/** Submit one transaction and wait for the scheduler to run it.
+ * @see I2CdevLinuxTransport::transfer()
+ */
+bool I2CdevClient::transfer(uint8_t devAddr, const uint8_t *writeData, uint16_t writeLength,
+                            uint8_t *readData, uint16_t readLength)
+{
+    I2CdevRequest request;
+    request.devAddr = devAddr;
+    request.writeData = writeData;
+    request.writeLength = writeLength;
+    request.readData = readData;
+    request.readLength = readLength;
+    request.status.store(I2CDEV_REQUEST_PENDING, std::memory_order_relaxed);
+
+    while (!submit(&request))
+        std::this_thread::yield(); // queue full, wait for the scheduler to catch up
+    wait(&request);
+    return request.getStatus() == I2CDEV_REQUEST_DONE;
+}
+
+/** Queue a request with this client's priority and deadline and return
+ * without waiting for it.
+ * @param request Filled request, must stay valid until completion
+ * @return Status of operation (false = submission queue full, try again later)
+ */
+bool I2CdevClient::submit(I2CdevRequest *request)
+{
+    request->owner = this;
+    request->priority = priority_;
+    request->submitted = I2CdevScheduler::now();
+    request->deadline = deadlineUs_ ? request->submitted + deadlineUs_ * 1000ULL : 0;
+    return scheduler_->submit(request);
+}
+
+/** Block until a request submitted through this client has completed.
+ * Completion of any of the client's requests wakes the caller, which then
+ * goes back to sleep if this one is still pending.
+ * @param request Request previously passed to submit()
+ */
+void I2CdevClient::wait(I2CdevRequest *request)
+{
+    uint64_t count;
+    while (!request->isDone())
+    {
+        if (read(doneFd_, &count, sizeof(count)) < 0 && errno != EINTR)
+        {
+            perror("Failed to wait for request");
+            return;
+        }
+    }
+}
+
+uint8_t I2CdevClient::getPriority()
+{
+    return priority_;
+}
+
+void I2CdevClient::setPriority(uint8_t priority)
+{
+    priority_ = priority;
+}
+
+uint32_t I2CdevClient::getDeadline()
+{
+    return deadlineUs_;
+}
+
+void I2CdevClient::setDeadline(uint32_t deadlineUs)
+{
+    deadlineUs_ = deadlineUs;
+}
+
+const char *I2CdevClient::getName()
+{
+    return name_;
+}
+
+/** Copy the latency statistics collected so far.
+ * @param stats Structure to fill
+ */
+void I2CdevClient::getStats(I2CdevLatencyStats *stats)
+{
+    stats->count = count_.load(std::memory_order_relaxed);
+    stats->errors = errors_.load(std::memory_order_relaxed);
+    stats->deadlineMisses = deadlineMisses_.load(std::memory_order_relaxed);
+    stats->maxUs = maxUs_.load(std::memory_order_relaxed);
+    for (uint8_t i = 0; i < I2CDEV_SCHED_HISTOGRAM_BINS; i++)
+        stats->bins[i] = bins_[i].load(std::memory_order_relaxed);
+}
+
+void I2CdevClient::resetStats()
+{
+    count_ = 0;
+    errors_ = 0;
+    deadlineMisses_ = 0;
+    maxUs_ = 0;
+    for (uint8_t i = 0; i < I2CDEV_SCHED_HISTOGRAM_BINS; i++)
+        bins_[i] = 0;
+}
+
+// runs on the scheduler thread, but also on the caller's thread when a
+// request completes in submit() or in the stop() drain, so update atomically
+void I2CdevClient::record(uint64_t latencyNs, bool status, bool missed)
+{
+    uint32_t us = latencyNs / 1000;
+    uint8_t bin = 0;
+    while (bin < I2CDEV_SCHED_HISTOGRAM_BINS - 1 && (us >> (bin + 1)) != 0)
+        bin++;
+
+    bins_[bin].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    if (!status)
+        errors_.fetch_add(1, std::memory_order_relaxed);
+    if (missed)
+        deadlineMisses_.fetch_add(1, std::memory_order_relaxed);
+    uint32_t max = maxUs_.load(std::memory_order_relaxed);
+    while (us > max && !maxUs_.compare_exchange_weak(max, us, std::memory_order_relaxed))
+        ;
+}
+
+void I2CdevClient::signal()
+{
+    uint64_t one = 1;
+    if (write(doneFd_, &one, sizeof(one)) < 0)
+        perror("Failed to signal client");
+}
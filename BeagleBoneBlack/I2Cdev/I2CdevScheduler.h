@@ -0,0 +1,214 @@
+// I2Cdev library collection - per-bus transaction scheduler for Linux hosts
+// One thread owns each /dev/i2c-N file descriptor and serves transactions
+// submitted by any number of client threads, most urgent first
+// Based on Arduino's I2Cdev by Jeff Rowberg <jeff@rowberg.net>
+//
+// Changelog:
+//      2026-10-19 - Initial release
+//      2026-10-19 - asynchronous submission through I2CdevClient::submit()
+//      2026-10-19 - I2CdevSimTransport::setClock() overrides I2CdevTransport::setClock()
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEVSCHEDULER_H_
+#define _I2CDEVSCHEDULER_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <thread>
+#include "I2Cdev.h"
+
+#define I2CDEV_SCHED_PRIORITIES     4   // 0 = most urgent
+#define I2CDEV_SCHED_QUEUE_DEPTH    64  // submission slots per priority, power of two
+#define I2CDEV_SCHED_HISTOGRAM_BINS 20  // bin n counts latencies in [2^n, 2^(n+1)) us
+
+#define I2CDEV_SCHED_PRIORITY_HIGH    0 // e.g. IMU FIFO drains
+#define I2CDEV_SCHED_PRIORITY_NORMAL  1
+#define I2CDEV_SCHED_PRIORITY_LOW     2
+#define I2CDEV_SCHED_PRIORITY_IDLE    3 // e.g. EEPROM and RTC housekeeping
+
+#define I2CDEV_SCHED_POLICY_PRIORITY  0 // priority, then deadline, then submission order
+#define I2CDEV_SCHED_POLICY_FIFO      1 // submission order only, for comparison
+
+class I2CdevClient;
+
+/** i2c-dev transport. Keeps the bus device open and issues each transaction
+ * as a single I2C_RDWR ioctl, so register address and data are joined by a
+ * repeated start and no other master can slip in between.
+ */
+class I2CdevLinuxTransport : public I2CdevTransport
+{
+public:
+  I2CdevLinuxTransport(uint8_t busAddr = DEFAULT_BBB_I2C_BUS);
+  ~I2CdevLinuxTransport();
+
+  bool begin();
+  void end();
+  bool transfer(uint8_t devAddr, const uint8_t *writeData, uint16_t writeLength,
+                uint8_t *readData, uint16_t readLength);
+
+private:
+  char path_[13]; // up to "/dev/i2c-255"
+  int fd_;
+};
+
+/** Simulated bus for host testing. Every 7-bit address is a 256-byte
+ * register file with auto-increment; each transaction takes as long as it
+ * would at the configured SCL clock (9 clocks per byte plus start/stop),
+ * plus an optional per-device delay standing in for clock stretching or
+ * EEPROM write cycles.
+ */
+class I2CdevSimTransport : public I2CdevTransport
+{
+public:
+  I2CdevSimTransport(uint32_t clockHz = 400000);
+
+  bool setClock(uint32_t clockHz);
+  void setDeviceDelay(uint8_t devAddr, uint32_t delayUs);
+  void setRegister(uint8_t devAddr, uint8_t regAddr, uint8_t value);
+  uint8_t getRegister(uint8_t devAddr, uint8_t regAddr);
+  uint32_t getTransferCount();
+
+  bool transfer(uint8_t devAddr, const uint8_t *writeData, uint16_t writeLength,
+                uint8_t *readData, uint16_t readLength);
+
+private:
+  uint32_t clockHz_;
+  uint32_t transfers_;
+  uint32_t delayUs_[128];
+  uint8_t pointer_[128];
+  uint8_t registers_[128][256];
+};
+
+/** Latency of one client's transactions, measured from submission to
+ * completion, so queueing behind other clients is included.
+ */
+struct I2CdevLatencyStats
+{
+  uint32_t count;
+  uint32_t errors;
+  uint32_t deadlineMisses;
+  uint32_t maxUs;
+  uint32_t bins[I2CDEV_SCHED_HISTOGRAM_BINS];
+};
+
+/** Bus owner thread. Requests are pushed onto one lock-free bounded queue
+ * per priority; the scheduler thread drains all queues after every
+ * transaction and runs the most urgent pending request next: lowest
+ * priority number first, then earliest deadline, then submission order.
+ * A transaction already on the wire is never interrupted, so the worst
+ * case wait for a high priority request is one low priority transaction.
+ */
+class I2CdevScheduler
+{
+public:
+  I2CdevScheduler(I2CdevTransport *transport);
+  ~I2CdevScheduler();
+
+  bool start();
+  void stop();
+  bool isRunning();
+  uint8_t getPolicy();
+  void setPolicy(uint8_t policy);
+
+  bool submit(I2CdevRequest *request);
+
+  static uint64_t now();
+
+private:
+  struct Slot
+  {
+    std::atomic<uint32_t> sequence;
+    I2CdevRequest *request;
+  };
+  struct Queue
+  {
+    Slot slots[I2CDEV_SCHED_QUEUE_DEPTH];
+    std::atomic<uint32_t> head; // next slot to fill (producers)
+    std::atomic<uint32_t> tail; // next slot to take (scheduler only)
+  };
+
+  bool push(Queue *queue, I2CdevRequest *request);
+  I2CdevRequest *pop(Queue *queue);
+  bool drain();
+  void complete(I2CdevRequest *request, bool status);
+  void run();
+
+  I2CdevTransport *transport_;
+  Queue queues_[I2CDEV_SCHED_PRIORITIES];
+  I2CdevRequest *pending_[I2CDEV_SCHED_PRIORITIES * I2CDEV_SCHED_QUEUE_DEPTH];
+  uint16_t pendingCount_;
+  uint8_t policy_;
+  int wakeFd_;
+  std::atomic<bool> idle_;
+  std::atomic<bool> running_;
+  std::thread thread_;
+};
+
+/** A scheduler user, typically one per device driver or thread. Pass a
+ * pointer to it as the wireObj argument of I2Cdev methods; each call then
+ * blocks until the scheduler has run the transaction. The *Async methods
+ * return as soon as the request is queued, and any number of requests may
+ * be outstanding. Callbacks run on the scheduler thread and must not make
+ * blocking I2Cdev calls on the same scheduler. A client must only be waited
+ * on by one thread at a time (give each thread its own client).
+ */
+class I2CdevClient : public I2CdevTransport
+{
+public:
+  I2CdevClient(I2CdevScheduler *scheduler, uint8_t priority = I2CDEV_SCHED_PRIORITY_NORMAL,
+               uint32_t deadlineUs = 0, const char *name = 0);
+  ~I2CdevClient();
+
+  bool transfer(uint8_t devAddr, const uint8_t *writeData, uint16_t writeLength,
+                uint8_t *readData, uint16_t readLength);
+  bool submit(I2CdevRequest *request);
+  void wait(I2CdevRequest *request);
+
+  uint8_t getPriority();
+  void setPriority(uint8_t priority);
+  uint32_t getDeadline();
+  void setDeadline(uint32_t deadlineUs);
+  const char *getName();
+
+  void getStats(I2CdevLatencyStats *stats);
+  void resetStats();
+
+private:
+  friend class I2CdevScheduler;
+  void record(uint64_t latencyNs, bool status, bool missed);
+  void signal();
+
+  I2CdevScheduler *scheduler_;
+  uint8_t priority_;
+  uint32_t deadlineUs_;
+  const char *name_;
+  int doneFd_;
+
+  // written by the scheduler thread, read by anyone
+  std::atomic<uint32_t> count_;
+  std::atomic<uint32_t> errors_;
+  std::atomic<uint32_t> deadlineMisses_;
+  std::atomic<uint32_t> maxUs_;
+  std::atomic<uint32_t> bins_[I2CDEV_SCHED_HISTOGRAM_BINS];
+};
+
+#endif /* _I2CDEVSCHEDULER_H_ */
@@ -0,0 +1,200 @@
+/*
+I2Cdev library collection - I2CdevAcquisition on a simulated bus
+An MPU6050 at 200 Hz, an HMC5883L at 75 Hz, a BMP085 (temperature plus
+pressure, 12 ms of conversion time) at 25 Hz and a DS1307 at 1 Hz share one
+simulated bus, each at its own maximum clock (400 kHz, the DS1307 at
+100 kHz) registered with I2Cdev::setDeviceClock(). The same register traffic is run first as a plain
+loop that reads every sensor in turn and sleeps through the BMP085
+conversions, then through the I2CdevAcquisition scheduler from the Arduino
+tree. Achieved rates, latency and bus utilisation are printed for both,
+followed by each device's throughput while it held the bus.
+No I2C hardware is required.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile on a BeagleBone Black (or any Linux host)
+  1. then from bash
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ g++ -O2 -std=c++11 -pthread -o I2CdevAcquisition_sim ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/examples/I2CdevAcquisition_sim.cpp \
+         -I ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/I2Cdev.cpp \
+         ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/I2CdevScheduler.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/I2CdevAcquisition ${PATH_I2CDEVLIB}Arduino/I2CdevAcquisition/I2CdevAcquisition.cpp
+      $ ./I2CdevAcquisition_sim [seconds]
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "I2Cdev.h"
+#include "I2CdevScheduler.h"
+#include "I2CdevAcquisition.h"
+
+#define MPU6050_ADDRESS     0x69 // AD0 high, the DS1307 has 0x68
+#define HMC5883L_ADDRESS    0x1E
+#define BMP085_ADDRESS      0x77
+#define DS1307_ADDRESS      0x68
+
+#define MPU6050_PERIOD_US   5000
+#define HMC5883L_PERIOD_US  13333
+#define BMP085_PERIOD_US    40000
+#define DS1307_PERIOD_US    1000000
+
+#define BMP085_TEMP_US      4500
+#define BMP085_PRESSURE_US  7500 // oversampling 1
+
+static I2CdevSimTransport bus(400000);
+static uint8_t data[14];
+
+static uint32_t nowUs() {
+  return I2CdevScheduler::now() / 1000;
+}
+
+static void sleepUs(uint32_t us) {
+  struct timespec ts;
+  ts.tv_sec = us / 1000000;
+  ts.tv_nsec = (us % 1000000) * 1000;
+  clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, NULL);
+}
+
+// register traffic of each driver's sampling sequence
+
+static int32_t mpu6050Step(void *, uint8_t) {
+  I2Cdev::readBytes(MPU6050_ADDRESS, 0x3B, 14, data, &bus); // getMotion6()
+  return I2CDEV_ACQ_DONE;
+}
+
+static int32_t hmc5883lStep(void *, uint8_t) {
+  I2Cdev::readByte(HMC5883L_ADDRESS, 0x09, data, &bus);    // STATUS
+  I2Cdev::readBytes(HMC5883L_ADDRESS, 0x03, 6, data, &bus); // DATAX_H..DATAY_L
+  return I2CDEV_ACQ_DONE;
+}
+
+static int32_t bmp085Step(void *, uint8_t phase) {
+  switch (phase) {
+    case 0:
+      I2Cdev::writeByte(BMP085_ADDRESS, 0xF4, 0x2E, &bus);     // start temperature
+      return BMP085_TEMP_US;
+    case 1:
+      I2Cdev::readBytes(BMP085_ADDRESS, 0xF6, 2, data, &bus);
+      I2Cdev::writeByte(BMP085_ADDRESS, 0xF4, 0x74, &bus);     // start pressure
+      return BMP085_PRESSURE_US;
+    default:
+      I2Cdev::readBytes(BMP085_ADDRESS, 0xF6, 3, data, &bus);
+      return I2CDEV_ACQ_DONE;
+  }
+}
+
+static int32_t ds1307Step(void *, uint8_t) {
+  I2Cdev::readBytes(DS1307_ADDRESS, 0x00, 7, data, &bus);
+  return I2CDEV_ACQ_DONE;
+}
+
+static void runSequential(int seconds) {
+  uint32_t count[4] = { 0, 0, 0, 0 };
+  uint32_t maxGap = 0, lastImu = 0, busUs = 0, lastRtc = 0;
+  uint32_t start = nowUs(), end = start + seconds * 1000000;
+
+  while ((int32_t)(nowUs() - end) < 0) {
+    uint32_t t = nowUs();
+    if (count[0] && t - lastImu > maxGap) maxGap = t - lastImu;
+    lastImu = t;
+    mpu6050Step(0, 0);
+    hmc5883lStep(0, 0);
+    busUs += nowUs() - t;
+    count[0]++;
+    count[1]++;
+    for (uint8_t phase = 0; ; phase++) {
+      t = nowUs();
+      int32_t wait = bmp085Step(0, phase);
+      busUs += nowUs() - t;
+      if (wait == I2CDEV_ACQ_DONE) break;
+      sleepUs(wait);
+    }
+    count[2]++;
+    if (count[3] == 0 || nowUs() - lastRtc >= DS1307_PERIOD_US) {
+      t = nowUs();
+      lastRtc = t;
+      ds1307Step(0, 0);
+      busUs += nowUs() - t;
+      count[3]++;
+    }
+  }
+  double elapsed = (nowUs() - start) * 1e-6;
+  printf("Sequential loop:\n");
+  printf("  MPU6050  %7.1f Hz (want %5.1f), longest gap %u us\n", count[0] / elapsed, 1e6 / MPU6050_PERIOD_US, maxGap);
+  printf("  HMC5883L %7.1f Hz (want %5.1f)\n", count[1] / elapsed, 1e6 / HMC5883L_PERIOD_US);
+  printf("  BMP085   %7.1f Hz (want %5.1f)\n", count[2] / elapsed, 1e6 / BMP085_PERIOD_US);
+  printf("  DS1307   %7.1f Hz (want %5.1f)\n", count[3] / elapsed, 1e6 / DS1307_PERIOD_US);
+  printf("  bus utilisation %.1f%%\n", 100.0 * busUs * 1e-6 / elapsed);
+}
+
+static void runScheduled(int seconds) {
+  I2CdevAcquisition acq(nowUs);
+  acq.addTask("DS1307", DS1307_PERIOD_US, ds1307Step);
+  acq.addTask("BMP085", BMP085_PERIOD_US, bmp085Step);
+  acq.addTask("HMC5883L", HMC5883L_PERIOD_US, hmc5883lStep);
+  acq.addTask("MPU6050", MPU6050_PERIOD_US, mpu6050Step);
+
+  uint32_t end = nowUs() + seconds * 1000000;
+  acq.start();
+  while ((int32_t)(nowUs() - end) < 0) {
+    uint32_t wait = acq.poll();
+    if (wait) sleepUs(wait);
+  }
+
+  double elapsed = seconds;
+  printf("I2CdevAcquisition:\n");
+  for (uint8_t i = 0; i < acq.getTaskCount(); i++) {
+    I2CdevAcquisitionStats stats;
+    acq.getStats(i, &stats);
+    printf("  %-8s %7.1f Hz, latency mean %5u us max %5u us, %u overruns\n", acq.getTaskName(i),
+           stats.samples / elapsed, stats.samples ? (uint32_t)(stats.sumLatencyUs / stats.samples) : 0,
+           stats.maxLatencyUs, stats.overruns);
+  }
+  printf("  bus utilisation %.1f%%\n", acq.getBusUtilization() / 10.0);
+}
+
+static void printDeviceStats(const char *name, uint8_t devAddr) {
+  I2CdevDeviceStats stats;
+  I2Cdev::getDeviceStats(devAddr, &stats, &bus);
+  printf("  %-8s %3u kHz, %6u transactions, %7u bytes, %6u bytes/s on the bus\n", name,
+         I2Cdev::getDeviceClock(devAddr, &bus) / 1000, stats.transactions, stats.bytes,
+         I2Cdev::getDeviceThroughput(devAddr, &bus));
+}
+
+int main(int argc, char **argv) {
+  int seconds = argc > 1 ? atoi(argv[1]) : 3;
+  I2Cdev::setBusClock(400000, &bus);
+  I2Cdev::setDeviceClock(MPU6050_ADDRESS, 400000, &bus);
+  I2Cdev::setDeviceClock(HMC5883L_ADDRESS, 400000, &bus);
+  I2Cdev::setDeviceClock(BMP085_ADDRESS, 400000, &bus);
+  I2Cdev::setDeviceClock(DS1307_ADDRESS, 100000, &bus);
+
+  runSequential(seconds);
+  runScheduled(seconds);
+
+  printf("Per-device traffic (both runs):\n");
+  printDeviceStats("MPU6050", MPU6050_ADDRESS);
+  printDeviceStats("HMC5883L", HMC5883L_ADDRESS);
+  printDeviceStats("BMP085", BMP085_ADDRESS);
+  printDeviceStats("DS1307", DS1307_ADDRESS);
+  return 0;
+}
@@ -0,0 +1,150 @@
+/*
+I2Cdev library collection - I2CdevScheduler load test
+Five threads share one simulated 400 kHz bus: an MPU6050 FIFO drain every
+2 ms with a 2 ms deadline, a DS1307 time read every 10 ms and three EEPROM
+page writers that never pause. The run is repeated in plain submission (FIFO)
+order, as with uncoordinated threads taking turns on a mutex, and with the
+IMU at high priority; the IMU latency histogram and deadline misses are
+printed for both.
+No I2C hardware is required.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile on a BeagleBone Black (or any Linux host)
+  1. then from bash
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ g++ -O2 -std=c++11 -pthread -o I2CdevScheduler_load ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/examples/I2CdevScheduler_load.cpp \
+         -I ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/I2Cdev.cpp \
+         ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/I2CdevScheduler.cpp
+      $ ./I2CdevScheduler_load [seconds]
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <atomic>
+#include <thread>
+#include "I2Cdev.h"
+#include "I2CdevScheduler.h"
+
+#define MPU6050_ADDRESS     0x69
+#define MPU6050_FIFO_R_W    0x74
+#define MPU6050_PACKET_SIZE 28
+#define DS1307_ADDRESS      0x68
+#define EEPROM_ADDRESS      0x50
+#define EEPROM_PAGE_SIZE    32
+#define EEPROM_WRITERS      3
+
+static std::atomic<bool> done;
+
+static void sleepUntil(uint64_t t) {
+  struct timespec ts;
+  ts.tv_sec = t / 1000000000ULL;
+  ts.tv_nsec = t % 1000000000ULL;
+  clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+}
+
+static void imuThread(I2CdevClient *client) {
+  uint8_t packet[MPU6050_PACKET_SIZE];
+  uint64_t next = I2CdevScheduler::now();
+  while (!done) {
+    I2Cdev::readBytes(MPU6050_ADDRESS, MPU6050_FIFO_R_W, MPU6050_PACKET_SIZE, packet, client);
+    next += 2000000;
+    sleepUntil(next);
+  }
+}
+
+static void rtcThread(I2CdevClient *client) {
+  uint8_t time[7];
+  uint64_t next = I2CdevScheduler::now();
+  while (!done) {
+    I2Cdev::readBytes(DS1307_ADDRESS, 0x00, 7, time, client);
+    next += 10000000;
+    sleepUntil(next);
+  }
+}
+
+static void eepromThread(I2CdevClient *client, uint8_t devAddr) {
+  uint8_t page[EEPROM_PAGE_SIZE];
+  uint8_t address = 0;
+  for (int i = 0; i < EEPROM_PAGE_SIZE; i++) page[i] = i;
+  while (!done) {
+    I2Cdev::writeBytes(devAddr, address, EEPROM_PAGE_SIZE, page, client);
+    address += EEPROM_PAGE_SIZE;
+  }
+}
+
+static void printStats(I2CdevClient *client) {
+  I2CdevLatencyStats stats;
+  client->getStats(&stats);
+  printf("  %-8s %7u requests, %u errors, %u deadline misses, max %u us\n", client->getName(),
+         stats.count, stats.errors, stats.deadlineMisses, stats.maxUs);
+}
+
+static void printHistogram(I2CdevClient *client) {
+  I2CdevLatencyStats stats;
+  client->getStats(&stats);
+  printf("  %s latency histogram:\n", client->getName());
+  for (int i = 0; i < I2CDEV_SCHED_HISTOGRAM_BINS; i++) {
+    if (stats.bins[i] == 0) continue;
+    printf("    %7u .. %7u us %8u  %5.1f%%\n", 1u << i, (2u << i) - 1, stats.bins[i], 100.0 * stats.bins[i] / stats.count);
+  }
+}
+
+static void run(const char *title, bool usePriorities, int seconds) {
+  I2CdevSimTransport bus(400000);
+  I2CdevScheduler scheduler(&bus);
+  scheduler.setPolicy(usePriorities ? I2CDEV_SCHED_POLICY_PRIORITY : I2CDEV_SCHED_POLICY_FIFO);
+  I2CdevClient imu(&scheduler, usePriorities ? I2CDEV_SCHED_PRIORITY_HIGH : I2CDEV_SCHED_PRIORITY_NORMAL, 2000, "MPU6050");
+  I2CdevClient rtc(&scheduler, usePriorities ? I2CDEV_SCHED_PRIORITY_LOW : I2CDEV_SCHED_PRIORITY_NORMAL, 0, "DS1307");
+  I2CdevClient *eeprom[EEPROM_WRITERS];
+  std::thread writers[EEPROM_WRITERS];
+
+  printf("%s\n", title);
+  if (!scheduler.start()) exit(1);
+  done = false;
+  std::thread t1(imuThread, &imu), t2(rtcThread, &rtc);
+  for (int i = 0; i < EEPROM_WRITERS; i++) {
+    eeprom[i] = new I2CdevClient(&scheduler, usePriorities ? I2CDEV_SCHED_PRIORITY_IDLE : I2CDEV_SCHED_PRIORITY_NORMAL, 0, "EEPROM");
+    writers[i] = std::thread(eepromThread, eeprom[i], EEPROM_ADDRESS + i);
+  }
+  sleep(seconds);
+  done = true;
+  t1.join();
+  t2.join();
+  for (int i = 0; i < EEPROM_WRITERS; i++) writers[i].join();
+  scheduler.stop();
+
+  printStats(&imu);
+  printStats(&rtc);
+  for (int i = 0; i < EEPROM_WRITERS; i++) {
+    printStats(eeprom[i]);
+    delete eeprom[i];
+  }
+  printHistogram(&imu);
+}
+
+int main(int argc, char **argv) {
+  int seconds = argc > 1 ? atoi(argv[1]) : 5;
+  run("Submission order (FIFO):", false, seconds);
+  run("MPU6050 at high priority, EEPROM at idle priority:", true, seconds);
+  return 0;
+}
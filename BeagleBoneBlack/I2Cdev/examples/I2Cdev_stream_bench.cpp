@@ -0,0 +1,91 @@
+/*
+I2Cdev library collection - streaming read benchmark
+Reads 28 B to 1 KB from a FIFO-style data port register on a simulated
+400 kHz bus three ways: in 32-byte readBytes() chunks that each re-send the
+register address (what the Arduino Wire buffer forces), in 127-byte
+readBytes() chunks (the int8_t count limit), and as one readStream()
+transaction. Prints bytes/second and transactions per transfer for each.
+No I2C hardware is required.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile on a BeagleBone Black (or any Linux host)
+  1. then from bash
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ g++ -O2 -std=c++11 -pthread -o I2Cdev_stream_bench ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/examples/I2Cdev_stream_bench.cpp \
+         -I ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/I2Cdev.cpp \
+         ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/I2CdevScheduler.cpp
+      $ ./I2Cdev_stream_bench [repeats]
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "I2Cdev.h"
+#include "I2CdevScheduler.h"
+
+#define MPU6050_ADDRESS     0x68
+#define MPU6050_FIFO_R_W    0x74
+#define WIRE_BUFFER_LENGTH  32 // AVR Wire
+
+static I2CdevSimTransport bus(400000);
+static uint8_t data[1024];
+
+static void readChunked(uint16_t length, uint8_t chunk) {
+  for (uint16_t k = 0; k < length; k += chunk) {
+    uint8_t n = length - k < chunk ? length - k : chunk;
+    I2Cdev::readBytes(MPU6050_ADDRESS, MPU6050_FIFO_R_W, n, data + k, &bus);
+  }
+}
+
+static void readStreamed(uint16_t length) {
+  I2Cdev::readStream(MPU6050_ADDRESS, MPU6050_FIFO_R_W, length, data, &bus);
+}
+
+// returns bytes/second, fills in transactions per transfer
+static double run(int mode, uint16_t length, int repeats, double *transactions) {
+  uint32_t before = bus.getTransferCount();
+  uint64_t t0 = I2CdevScheduler::now();
+  for (int n = 0; n < repeats; n++) {
+    if (mode == 0) readChunked(length, WIRE_BUFFER_LENGTH);
+    else if (mode == 1) readChunked(length, 127);
+    else readStreamed(length);
+  }
+  uint64_t t1 = I2CdevScheduler::now();
+  *transactions = (double)(bus.getTransferCount() - before) / repeats;
+  return (double)length * repeats / ((t1 - t0) * 1e-9);
+}
+
+int main(int argc, char **argv) {
+  int repeats = argc > 1 ? atoi(argv[1]) : 50;
+  static const uint16_t lengths[] = { 28, 64, 128, 256, 512, 1024 };
+
+  printf("%6s  %22s  %22s  %22s\n", "bytes", "readBytes x32", "readBytes x127", "readStream");
+  for (unsigned i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+    printf("%6u", lengths[i]);
+    for (int mode = 0; mode < 3; mode++) {
+      double transactions;
+      double rate = run(mode, lengths[i], repeats, &transactions);
+      printf("  %8.0f B/s (%4.1f tx)", rate, transactions);
+    }
+    printf("\n");
+  }
+  return 0;
+}
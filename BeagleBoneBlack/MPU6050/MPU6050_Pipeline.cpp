@@ -0,0 +1,356 @@
+// I2Cdev library collection - interrupt-driven MPU6050 FIFO pipeline for Linux hosts
+// Waits for INT pin edges on a gpiochip line and hands every FIFO packet to
+// registered consumers, with a polling fallback for missed or unwired edges
+// Based on Arduino's I2Cdev by Jeff Rowberg <jeff@rowberg.net>
+//
+// Changelog:
+//      2026-10-19 - Initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "MPU6050_Pipeline.h"
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static uint64_t nowNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// ============================================================================
+// I2CdevGpioLine
+// ============================================================================
+
+/** Describe a GPIO line; begin() requests it.
+ * @param chip Character device of the GPIO controller, e.g. "/dev/gpiochip0"
+ * @param line Line offset on that controller (BCM GPIO number on a Raspberry Pi)
+ * @param risingEdge True for rising edges (INT active high), false for falling
+ */
+I2CdevGpioLine::I2CdevGpioLine(const char *chip, uint32_t line, bool risingEdge)
+    : chip_(chip), line_(line), risingEdge_(risingEdge), fd_(-1)
+{
+}
+
+I2CdevGpioLine::~I2CdevGpioLine()
+{
+    end();
+}
+
+/** Request the line as an input with edge events.
+ * @return Status of operation (true = success)
+ */
+bool I2CdevGpioLine::begin()
+{
+    if (fd_ >= 0)
+        return true;
+
+    int chipFd = open(chip_, O_RDONLY | O_CLOEXEC);
+    if (chipFd < 0)
+    {
+        fprintf(stderr, "Failed to open %s. %s\n", chip_, strerror(errno));
+        return false;
+    }
+
+    struct gpioevent_request req;
+    memset(&req, 0, sizeof(req));
+    req.lineoffset = line_;
+    req.handleflags = GPIOHANDLE_REQUEST_INPUT;
+    req.eventflags = risingEdge_ ? GPIOEVENT_REQUEST_RISING_EDGE : GPIOEVENT_REQUEST_FALLING_EDGE;
+    strncpy(req.consumer_label, "i2cdevlib", sizeof(req.consumer_label) - 1);
+    int ok = ioctl(chipFd, GPIO_GET_LINEEVENT_IOCTL, &req);
+    close(chipFd);
+    if (ok < 0)
+    {
+        fprintf(stderr, "Failed to request line %u of %s. %s\n", line_, chip_, strerror(errno));
+        return false;
+    }
+
+    fd_ = req.fd;
+    fcntl(fd_, F_SETFL, fcntl(fd_, F_GETFL) | O_NONBLOCK);
+    return true;
+}
+
+/** Release the line. */
+void I2CdevGpioLine::end()
+{
+    if (fd_ >= 0)
+    {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+
+int I2CdevGpioLine::getFd()
+{
+    return fd_;
+}
+
+/** Take one pending edge without blocking.
+ * @param timestampNs Kernel timestamp of the edge
+ * @return False if no edge was pending
+ */
+bool I2CdevGpioLine::readEdge(uint64_t *timestampNs)
+{
+    struct gpioevent_data event;
+    if (read(fd_, &event, sizeof(event)) != sizeof(event))
+        return false;
+    *timestampNs = event.timestamp;
+    return true;
+}
+
+// ============================================================================
+// I2CdevSimLine
+// ============================================================================
+
+I2CdevSimLine::I2CdevSimLine()
+{
+    if (pipe2(fds_, O_NONBLOCK | O_CLOEXEC) < 0)
+    {
+        perror("Failed to create simulated GPIO line");
+        fds_[0] = fds_[1] = -1;
+    }
+}
+
+I2CdevSimLine::~I2CdevSimLine()
+{
+    if (fds_[0] >= 0)
+    {
+        close(fds_[0]);
+        close(fds_[1]);
+    }
+}
+
+/** Queue one edge.
+ * @param timestampNs Edge time on CLOCK_MONOTONIC
+ */
+void I2CdevSimLine::trigger(uint64_t timestampNs)
+{
+    if (write(fds_[1], &timestampNs, sizeof(timestampNs)) != sizeof(timestampNs))
+        perror("Failed to trigger simulated GPIO line");
+}
+
+int I2CdevSimLine::getFd()
+{
+    return fds_[0];
+}
+
+bool I2CdevSimLine::readEdge(uint64_t *timestampNs)
+{
+    return read(fds_[0], timestampNs, sizeof(*timestampNs)) == sizeof(*timestampNs);
+}
+
+// ============================================================================
+// MPU6050Pipeline
+// ============================================================================
+
+/** Set up a pipeline; nothing touches the bus until start().
+ * @param mpu Configured device (any MPU6050 class from the shared core)
+ * @param packetSize FIFO packet size in bytes, e.g. dmpGetFIFOPacketSize()
+ * @param edges INT pin edge source (0 to poll only)
+ * @param pollUs Fallback poll interval in microseconds
+ */
+MPU6050Pipeline::MPU6050Pipeline(MPU6050_Base *mpu, uint16_t packetSize, I2CdevEdgeSource *edges, uint32_t pollUs)
+    : mpu_(mpu), packetSize_(packetSize), edges_(edges), pollUs_(pollUs), consumerCount_(0), wakeFd_(-1), running_(false)
+{
+    memset(&stats_, 0, sizeof(stats_));
+}
+
+MPU6050Pipeline::~MPU6050Pipeline()
+{
+    stop();
+}
+
+/** Register a packet consumer. Only call while the pipeline is stopped.
+ * @param callback Function to call for every packet
+ * @param arg Passed to callback
+ * @return False if MPU6050_PIPELINE_MAX_CONSUMERS are registered already
+ */
+bool MPU6050Pipeline::addConsumer(MPU6050PacketCallback callback, void *arg)
+{
+    if (consumerCount_ == MPU6050_PIPELINE_MAX_CONSUMERS)
+        return false;
+    consumers_[consumerCount_].callback = callback;
+    consumers_[consumerCount_].arg = arg;
+    consumerCount_++;
+    return true;
+}
+
+/** Reset the FIFO, drop edges that are already pending and start the
+ * pipeline thread.
+ * @return Status of operation (true = success)
+ */
+bool MPU6050Pipeline::start()
+{
+    if (running_)
+        return true;
+    if (packetSize_ == 0 || packetSize_ > MPU6050_PIPELINE_BUFFER_SIZE)
+        return false;
+    if ((wakeFd_ = eventfd(0, EFD_CLOEXEC)) < 0)
+    {
+        perror("Failed to create pipeline eventfd");
+        return false;
+    }
+    uint64_t ts;
+    while (edges_ && edges_->readEdge(&ts))
+        ;
+    mpu_->resetFIFO();
+    running_ = true;
+    thread_ = std::thread(&MPU6050Pipeline::run, this);
+    return true;
+}
+
+/** Stop the pipeline thread. Packets still in the FIFO stay there. */
+void MPU6050Pipeline::stop()
+{
+    if (!running_)
+        return;
+    running_ = false;
+    uint64_t one = 1;
+    if (write(wakeFd_, &one, sizeof(one)) < 0)
+        perror("Failed to wake pipeline");
+    thread_.join();
+    close(wakeFd_);
+    wakeFd_ = -1;
+}
+
+bool MPU6050Pipeline::isRunning()
+{
+    return running_;
+}
+
+/** Get the counters since construction or resetStats().
+ * @param stats Receives a copy of the counters
+ */
+void MPU6050Pipeline::getStats(MPU6050PipelineStats *stats)
+{
+    std::lock_guard<std::mutex> guard(statsLock_);
+    *stats = stats_;
+}
+
+void MPU6050Pipeline::resetStats()
+{
+    std::lock_guard<std::mutex> guard(statsLock_);
+    memset(&stats_, 0, sizeof(stats_));
+}
+
+/** Pipeline thread: sleep until an edge, a stop request or the fallback
+ * poll interval, then read the FIFO. Edges that queued up while the FIFO
+ * was being read are taken together, since one read collects all their
+ * packets; the oldest edge's timestamp is used for the latency.
+ */
+void MPU6050Pipeline::run()
+{
+    struct pollfd fds[2];
+    fds[0].fd = wakeFd_;
+    fds[0].events = POLLIN;
+    fds[1].fd = edges_ ? edges_->getFd() : -1;
+    fds[1].events = POLLIN;
+
+    struct timespec timeout;
+    timeout.tv_sec = pollUs_ / 1000000;
+    timeout.tv_nsec = (pollUs_ % 1000000) * 1000;
+
+    while (running_)
+    {
+        int ready = ppoll(fds, 2, &timeout, NULL);
+        if (!running_)
+            break;
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            perror("Pipeline poll failed");
+            break;
+        }
+        if (ready == 0)
+        {
+            {
+                std::lock_guard<std::mutex> guard(statsLock_);
+                stats_.polls++;
+            }
+            service(nowNs());
+            continue;
+        }
+        if (fds[1].revents & POLLIN)
+        {
+            uint64_t first = 0, ts;
+            uint32_t count = 0;
+            while (edges_->readEdge(&ts))
+            {
+                if (count++ == 0)
+                    first = ts;
+            }
+            if (count)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(statsLock_);
+                    stats_.edges += count;
+                }
+                service(first);
+            }
+        }
+    }
+}
+
+/** Read and dispatch everything the FIFO holds: INT_STATUS (which also
+ * clears a latched interrupt), FIFO_COUNT, then all whole packets in one
+ * streamed read. Overflow recovery and the packet accounting are done by
+ * MPU6050_Base::getFIFOPackets(), see MPU6050_Base::getFIFOStats().
+ * @param timestampNs Edge or poll time the read belongs to
+ */
+void MPU6050Pipeline::service(uint64_t timestampNs)
+{
+    uint16_t packets = mpu_->getFIFOPackets(buffer_, MPU6050_PIPELINE_BUFFER_SIZE / packetSize_, packetSize_);
+    if (packets == 0)
+    {
+        std::lock_guard<std::mutex> guard(statsLock_);
+        stats_.emptyReads++;
+        return;
+    }
+
+    for (uint16_t p = 0; p < packets; p++)
+    {
+        for (uint8_t c = 0; c < consumerCount_; c++)
+            consumers_[c].callback(buffer_ + p * packetSize_, packetSize_, timestampNs, consumers_[c].arg);
+    }
+
+    uint64_t now = nowNs();
+    std::lock_guard<std::mutex> guard(statsLock_);
+    stats_.reads++;
+    stats_.packets += packets;
+    if (now >= timestampNs) // not a CLOCK_REALTIME edge from an older kernel
+    {
+        uint32_t latencyUs = (now - timestampNs) / 1000;
+        stats_.sumLatencyUs += latencyUs;
+        if (latencyUs > stats_.maxLatencyUs)
+            stats_.maxLatencyUs = latencyUs;
+    }
+}
@@ -0,0 +1,162 @@
+// I2Cdev library collection - interrupt-driven MPU6050 FIFO pipeline for Linux hosts
+// Waits for INT pin edges on a gpiochip line and hands every FIFO packet to
+// registered consumers, with a polling fallback for missed or unwired edges
+// Based on Arduino's I2Cdev by Jeff Rowberg <jeff@rowberg.net>
+//
+// Changelog:
+//      2026-10-19 - Overflow recovery and loss counters moved to MPU6050_Base::getFIFOPackets()
+//      2026-10-19 - Initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050_PIPELINE_H_
+#define _MPU6050_PIPELINE_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include "MPU6050.h"
+
+#define MPU6050_PIPELINE_MAX_CONSUMERS  4
+#define MPU6050_PIPELINE_POLL_US        100000  // fallback poll after this long without an edge
+#define MPU6050_PIPELINE_BUFFER_SIZE    1024    // the whole FIFO
+
+/** Source of interrupt edges. getFd() must become readable (for poll())
+ * while an edge is pending, and readEdge() consumes one.
+ */
+class I2CdevEdgeSource
+{
+public:
+  virtual ~I2CdevEdgeSource() {}
+  virtual int getFd() = 0;
+  virtual bool readEdge(uint64_t *timestampNs) = 0;
+};
+
+/** Edge events of one GPIO line through the gpiochip character device
+ * (GPIO_GET_LINEEVENT_IOCTL, Linux 4.8+). The kernel timestamps each edge
+ * in its interrupt handler, CLOCK_MONOTONIC from Linux 5.7 on and
+ * CLOCK_REALTIME before that.
+ */
+class I2CdevGpioLine : public I2CdevEdgeSource
+{
+public:
+  I2CdevGpioLine(const char *chip, uint32_t line, bool risingEdge = true);
+  ~I2CdevGpioLine();
+
+  bool begin();
+  void end();
+  int getFd();
+  bool readEdge(uint64_t *timestampNs);
+
+private:
+  const char *chip_;
+  uint32_t line_;
+  bool risingEdge_;
+  int fd_;
+};
+
+/** Simulated interrupt line for host testing: every trigger() queues one
+ * edge. Safe to trigger from any thread.
+ */
+class I2CdevSimLine : public I2CdevEdgeSource
+{
+public:
+  I2CdevSimLine();
+  ~I2CdevSimLine();
+
+  void trigger(uint64_t timestampNs);
+  int getFd();
+  bool readEdge(uint64_t *timestampNs);
+
+private:
+  int fds_[2]; // pipe, one 8-byte timestamp per edge
+};
+
+/** Called on the pipeline thread for every packet read from the FIFO, in
+ * FIFO order. timestampNs is the edge (or fallback poll) that led to the
+ * read; when several packets were waiting, they all share it.
+ */
+typedef void (*MPU6050PacketCallback)(const uint8_t *packet, uint16_t length, uint64_t timestampNs, void *arg);
+
+struct MPU6050PipelineStats
+{
+  uint32_t edges;        // edges received
+  uint32_t polls;        // fallback polls (no edge within the poll interval)
+  uint32_t emptyReads;   // edges or polls that found less than one packet
+  uint32_t reads;        // FIFO reads that dispatched packets
+  uint32_t packets;      // packets dispatched, losses are in MPU6050_Base::getFIFOStats()
+  uint32_t maxLatencyUs; // edge timestamp to dispatch of its last packet
+  uint64_t sumLatencyUs; // divide by reads for the mean
+};
+
+/** Event-driven MPU6050 FIFO reader. A thread sleeps in poll() on the edge
+ * source and, on each edge, reads INT_STATUS, FIFO_COUNT and all whole
+ * packets waiting in the FIFO (one readStream(), so three transactions
+ * however many packets have queued) and passes each packet to the
+ * consumers. If no edge arrives for pollUs (INT not wired, or an edge was
+ * missed), the FIFO is read anyway; without an edge source the pipeline
+ * is a plain poller at that interval.
+ *
+ * Configure the device first (DMP or FIFO enabled, the data ready or DMP
+ * interrupt enabled, INT active high to match a rising edge source), and
+ * leave the bus to the pipeline thread while it runs.
+ */
+class MPU6050Pipeline
+{
+public:
+  MPU6050Pipeline(MPU6050_Base *mpu, uint16_t packetSize, I2CdevEdgeSource *edges = 0,
+                  uint32_t pollUs = MPU6050_PIPELINE_POLL_US);
+  ~MPU6050Pipeline();
+
+  bool addConsumer(MPU6050PacketCallback callback, void *arg = 0);
+  bool start();
+  void stop();
+  bool isRunning();
+
+  void getStats(MPU6050PipelineStats *stats);
+  void resetStats();
+
+private:
+  struct Consumer
+  {
+    MPU6050PacketCallback callback;
+    void *arg;
+  };
+
+  void run();
+  void service(uint64_t timestampNs);
+
+  MPU6050_Base *mpu_;
+  uint16_t packetSize_;
+  I2CdevEdgeSource *edges_;
+  uint32_t pollUs_;
+  Consumer consumers_[MPU6050_PIPELINE_MAX_CONSUMERS];
+  uint8_t consumerCount_;
+  uint8_t buffer_[MPU6050_PIPELINE_BUFFER_SIZE];
+  int wakeFd_;
+  std::atomic<bool> running_;
+  std::thread thread_;
+  std::mutex statsLock_;
+  MPU6050PipelineStats stats_;
+};
+
+#endif /* _MPU6050_PIPELINE_H_ */
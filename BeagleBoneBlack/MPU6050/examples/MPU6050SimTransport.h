@@ -0,0 +1,197 @@
+/*
+I2Cdev library collection - simulated MPU6050 for the host examples
+Register file, DMP memory and a FIFO filled with DMP packets behind a
+simulated 400 kHz bus, shared by the examples in this directory.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050SIMTRANSPORT_H_
+#define _MPU6050SIMTRANSPORT_H_
+
+#include <string.h>
+#include "I2CdevScheduler.h"
+#include "MPU6050.h"
+
+#define SIM_PACKET_US       10000   // DMP output rate, 200 Hz / (1 + D_0_22 divisor 1)
+#define SIM_FIFO_SIZE       1024
+#define SIM_QUAT_ONE        0x4000  // high word of the quaternion w component at 1.0
+
+/** MPU6050 behind a simulated 400 kHz bus. Register accesses take bus
+ * time as on I2CdevSimTransport; MEM_R_W goes to the DMP memory and
+ * FIFO_R_W drains a FIFO that the "DMP" fills once FIFO and DMP are
+ * enabled. Every packet carries a sequence number in the low word of the
+ * quaternion w component so consumers can tell how old it is. A full FIFO
+ * drops its oldest byte, as the chip does, which misaligns a reader that
+ * falls behind.
+ */
+class MPU6050SimTransport : public I2CdevSimTransport
+{
+public:
+  MPU6050SimTransport(uint16_t packetSize) : I2CdevSimTransport(400000), packetSize_(packetSize)
+  {
+    reset();
+  }
+
+  bool transfer(uint8_t devAddr, const uint8_t *writeData, uint16_t writeLength,
+                uint8_t *readData, uint16_t readLength)
+  {
+    // packets the DMP writes while a long FIFO read is on the bus go in
+    // behind the bytes being read, so catch up before the bus time
+    produce();
+    // bus timing only: the simulated device below keeps its own registers
+    I2CdevSimTransport::transfer(0x7F, writeData, writeLength, readData, readLength);
+    if (devAddr != MPU6050_DEFAULT_ADDRESS)
+      return false;
+    if (writeLength)
+      pointer_ = writeData[0];
+    for (uint16_t i = 1; i < writeLength; i++)
+      writeRegister(writeData[i]);
+    for (uint16_t i = 0; i < readLength; i++)
+      readData[i] = readRegister();
+    return true;
+  }
+
+  // production time of the packet with the given sequence number
+  uint64_t producedAt(uint16_t seq) { return producedAt_[seq & 1023]; }
+
+  // time of the first packet after FIFO and DMP were enabled, later ones
+  // follow every SIM_PACKET_US (the INT pin schedule)
+  uint64_t firstPacketAt() { return firstPacket_; }
+
+private:
+  void reset()
+  {
+    memset(regs_, 0, sizeof(regs_));
+    regs_[MPU6050_RA_PWR_MGMT_1] = 0x40;
+    regs_[MPU6050_RA_WHO_AM_I] = 0x68;
+    fifoHead_ = fifoCount_ = 0;
+    seq_ = 0;
+    firstPacket_ = nextPacket_ = 0;
+  }
+
+  void writeRegister(uint8_t value)
+  {
+    uint8_t reg = pointer_;
+    switch (reg)
+    {
+    case MPU6050_RA_PWR_MGMT_1:
+      if (value & 0x80)
+      {
+        reset();
+        return;
+      }
+      break;
+    case MPU6050_RA_USER_CTRL:
+      if (value & 0x04)
+        fifoCount_ = 0;
+      if ((value & 0xC0) == 0xC0 && (regs_[reg] & 0xC0) != 0xC0)
+        firstPacket_ = nextPacket_ = I2CdevScheduler::now() / 1000 + SIM_PACKET_US;
+      value &= ~0x0D; // reset bits clear themselves
+      break;
+    case MPU6050_RA_MEM_R_W:
+      memory_[regs_[MPU6050_RA_BANK_SEL] & 0x1F][regs_[MPU6050_RA_MEM_START_ADDR]++] = value;
+      return; // MEM_R_W and FIFO_R_W do not advance the register pointer
+    case MPU6050_RA_FIFO_R_W:
+      return;
+    }
+    regs_[reg] = value;
+    pointer_++;
+  }
+
+  uint8_t readRegister()
+  {
+    uint8_t reg = pointer_;
+    switch (reg)
+    {
+    case MPU6050_RA_MEM_R_W:
+      return memory_[regs_[MPU6050_RA_BANK_SEL] & 0x1F][regs_[MPU6050_RA_MEM_START_ADDR]++];
+    case MPU6050_RA_FIFO_R_W:
+    {
+      if (!fifoCount_)
+        return 0;
+      uint8_t b = fifo_[fifoHead_];
+      fifoHead_ = (fifoHead_ + 1) % SIM_FIFO_SIZE;
+      fifoCount_--;
+      return b;
+    }
+    case MPU6050_RA_FIFO_COUNTH:
+      pointer_++;
+      return fifoCount_ >> 8;
+    case MPU6050_RA_FIFO_COUNTL:
+      pointer_++;
+      return fifoCount_ & 0xFF;
+    case MPU6050_RA_INT_STATUS:
+    {
+      uint8_t status = regs_[reg];
+      regs_[reg] = 0; // cleared on read
+      pointer_++;
+      return status;
+    }
+    }
+    pointer_++;
+    return regs_[reg];
+  }
+
+  // append the packets the DMP has written since the last transfer
+  void produce()
+  {
+    if ((regs_[MPU6050_RA_USER_CTRL] & 0xC0) != 0xC0)
+      return;
+    uint64_t now = I2CdevScheduler::now() / 1000;
+    while (nextPacket_ <= now)
+    {
+      uint8_t packet[64];
+      memset(packet, 0, packetSize_);
+      packet[0] = SIM_QUAT_ONE >> 8;
+      packet[1] = SIM_QUAT_ONE & 0xFF;
+      packet[2] = seq_ >> 8;
+      packet[3] = seq_ & 0xFF;
+      producedAt_[seq_ & 1023] = nextPacket_;
+      seq_++;
+      for (uint16_t i = 0; i < packetSize_; i++)
+      {
+        if (fifoCount_ == SIM_FIFO_SIZE)
+        {
+          fifoHead_ = (fifoHead_ + 1) % SIM_FIFO_SIZE;
+          fifoCount_--;
+          regs_[MPU6050_RA_INT_STATUS] |= 1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT;
+        }
+        fifo_[(fifoHead_ + fifoCount_++) % SIM_FIFO_SIZE] = packet[i];
+      }
+      regs_[MPU6050_RA_INT_STATUS] |= 1 << MPU6050_INTERRUPT_DMP_INT_BIT;
+      nextPacket_ += SIM_PACKET_US;
+    }
+  }
+
+  uint16_t packetSize_;
+  uint8_t pointer_;
+  uint8_t regs_[256];
+  uint8_t memory_[32][256];
+  uint8_t fifo_[SIM_FIFO_SIZE];
+  uint16_t fifoHead_;
+  uint16_t fifoCount_;
+  uint16_t seq_;
+  uint64_t nextPacket_;
+  uint64_t firstPacket_;
+  uint64_t producedAt_[1024];
+};
+
+#endif /* _MPU6050SIMTRANSPORT_H_ */
@@ -0,0 +1,191 @@
+/*
+I2Cdev library collection - shared MPU6050 core on a simulated bus
+Builds the platform-independent MPU6050 driver and MotionApps 6.12 DMP code
+from the Arduino tree against the Linux I2Cdev port, runs dmpInitialize()
+on a simulated MPU6050 (register file, DMP memory and a FIFO filled with
+100 Hz DMP packets) and then consumes packets two ways: the oldest-first
+getFIFOCount()/getFIFOBytes() loop of the older per-platform copies, and the
+core's overflow-proof dmpGetCurrentFIFOPacket(). Each consumer spends a
+fixed time per packet on "application work"; for both, the packet rate, the
+age of the packets used, corrupt (misaligned) packets and I2C transactions
+per packet are printed, and for dmpGetCurrentFIFOPacket() the driver's
+count of packets it skipped (MPU6050_Base::getFIFOStats()). Finally, a
+transfer that is cut short every 200 ms (5 bytes of a packet read and
+lost) knocks an oldest-first reader off the packet boundaries; a plain
+getFIFOPackets() reader stays misaligned while dmpGetFIFOPackets() spots
+the bad packets and realigns. No I2C hardware is required.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile on a BeagleBone Black (or any Linux host)
+  1. then from bash
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ g++ -O2 -std=c++11 -pthread -o MPU6050_core_sim ${PATH_I2CDEVLIB}BeagleBoneBlack/MPU6050/examples/MPU6050_core_sim.cpp \
+         -I ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/I2Cdev.cpp \
+         ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/I2CdevScheduler.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/I2Cdev ${PATH_I2CDEVLIB}Arduino/I2Cdev/I2CdevConfig.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/MPU6050 ${PATH_I2CDEVLIB}Arduino/MPU6050/MPU6050.cpp \
+         ${PATH_I2CDEVLIB}Arduino/MPU6050/MPU6050_6Axis_MotionApps612.cpp
+      $ ./MPU6050_core_sim [seconds]
+
+  The BeagleBoneBlack/I2Cdev directory must come first on the include path
+  so that its I2Cdev.h is used instead of the Arduino one.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "I2Cdev.h"
+#include "I2CdevScheduler.h"
+#include "MPU6050_6Axis_MotionApps612.h"
+#include "MPU6050SimTransport.h"
+
+#define GLITCH_US           200000
+
+static MPU6050SimTransport bus(28);
+static MPU6050 mpu(MPU6050_DEFAULT_ADDRESS, &bus);
+
+static void sleepUs(uint32_t us)
+{
+  struct timespec ts;
+  ts.tv_sec = us / 1000000;
+  ts.tv_nsec = (us % 1000000) * 1000;
+  clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, NULL);
+}
+
+static void consume(const char *name, bool current, uint32_t workUs, int seconds)
+{
+  uint16_t packetSize = mpu.dmpGetFIFOPacketSize();
+  uint8_t packet[64];
+  uint32_t used = 0, corrupt = 0;
+  uint64_t ageSum = 0;
+  Quaternion q;
+  VectorFloat gravity;
+  float ypr[3];
+
+  mpu.resetFIFO();
+  mpu.resetFIFOStats();
+  uint32_t transfers = bus.getTransferCount();
+  uint64_t start = I2CdevScheduler::now() / 1000, end = start + seconds * 1000000ULL;
+  while (I2CdevScheduler::now() / 1000 < end)
+  {
+    bool got;
+    if (current)
+    {
+      got = mpu.dmpGetCurrentFIFOPacket(packet);
+    }
+    else
+    {
+      got = mpu.getFIFOCount() >= packetSize;
+      if (got)
+        mpu.getFIFOBytes(packet, packetSize);
+    }
+    if (!got)
+    {
+      sleepUs(1000);
+      continue;
+    }
+    used++;
+    if (((packet[0] << 8) | packet[1]) != SIM_QUAT_ONE)
+    {
+      corrupt++;
+    }
+    else
+    {
+      ageSum += I2CdevScheduler::now() / 1000 - bus.producedAt((packet[2] << 8) | packet[3]);
+      mpu.dmpGetQuaternion(&q, packet);
+      mpu.dmpGetGravity(&gravity, &q);
+      mpu.dmpGetYawPitchRoll(ypr, &q, &gravity);
+    }
+    sleepUs(workUs);
+  }
+  transfers = bus.getTransferCount() - transfers;
+  uint32_t good = used - corrupt;
+  printf("  %-26s %6.1f packets/s, mean age %7.1f ms, %5u corrupt, %5.1f transactions/packet\n", name,
+         used / (double)seconds, good ? ageSum / 1000.0 / good : 0.0, corrupt, used ? transfers / (double)used : 0.0);
+  if (current)
+  {
+    MPU6050FIFOStats fifo;
+    mpu.getFIFOStats(&fifo);
+    printf("  %-26s FIFO: %u delivered, %u dropped, %u overflows, %u resyncs, %u resets, %u invalid\n", "",
+           fifo.delivered, fifo.dropped, fifo.overflows, fifo.resyncs, fifo.resets, fifo.invalid);
+  }
+}
+
+static void consumeGlitched(const char *name, bool validate, int seconds)
+{
+  uint16_t packetSize = mpu.dmpGetFIFOPacketSize();
+  uint8_t packets[MPU6050_FIFO_SIZE];
+  uint32_t used = 0, corrupt = 0;
+
+  mpu.resetFIFO();
+  mpu.resetFIFOStats();
+  uint64_t start = I2CdevScheduler::now() / 1000, end = start + seconds * 1000000ULL, glitch = start + GLITCH_US;
+  while (I2CdevScheduler::now() / 1000 < end)
+  {
+    if (I2CdevScheduler::now() / 1000 >= glitch)
+    {
+      mpu.getFIFOBytes(packets, 5);
+      glitch += GLITCH_US;
+    }
+    uint16_t count = validate ? mpu.dmpGetFIFOPackets(packets, sizeof(packets) / packetSize)
+                              : mpu.getFIFOPackets(packets, sizeof(packets) / packetSize, packetSize);
+    for (uint16_t i = 0; i < count; i++)
+    {
+      used++;
+      if (((packets[i * packetSize] << 8) | packets[i * packetSize + 1]) != SIM_QUAT_ONE)
+        corrupt++;
+    }
+    sleepUs(5000);
+  }
+  MPU6050FIFOStats fifo;
+  mpu.getFIFOStats(&fifo);
+  printf("  %-26s %6.1f packets/s, %5u corrupt, FIFO: %u dropped, %u resyncs, %u resets, %u invalid\n", name,
+         used / (double)seconds, corrupt, fifo.dropped, fifo.resyncs, fifo.resets, fifo.invalid);
+}
+
+int main(int argc, char **argv)
+{
+  int seconds = argc > 1 ? atoi(argv[1]) : 3;
+
+  uint32_t transfers = bus.getTransferCount();
+  uint64_t t0 = I2CdevScheduler::now();
+  mpu.initialize();
+  if (!mpu.testConnection() || mpu.dmpInitialize() != 0)
+  {
+    fprintf(stderr, "DMP initialization failed\n");
+    return 1;
+  }
+  uint64_t t1 = I2CdevScheduler::now();
+  printf("initialize() + dmpInitialize(): %.1f ms, %u transactions\n", (t1 - t0) * 1e-6, bus.getTransferCount() - transfers);
+  mpu.setDMPEnabled(true);
+
+  printf("2 ms of work per packet (consumer keeps up):\n");
+  consume("getFIFOBytes() oldest", false, 2000, seconds);
+  consume("dmpGetCurrentFIFOPacket()", true, 2000, seconds);
+  printf("25 ms of work per packet (consumer falls behind):\n");
+  consume("getFIFOBytes() oldest", false, 25000, seconds);
+  consume("dmpGetCurrentFIFOPacket()", true, 25000, seconds);
+  printf("Every %u ms a transfer is cut short and 5 FIFO bytes are lost:\n", GLITCH_US / 1000);
+  consumeGlitched("getFIFOPackets()", false, seconds);
+  consumeGlitched("dmpGetFIFOPackets()", true, seconds);
+  return 0;
+}
@@ -0,0 +1,212 @@
+/*
+I2Cdev library collection - MPU6050Pipeline on a simulated bus and INT line
+Runs the DMP of the simulated MPU6050 from MPU6050SimTransport.h (100 Hz
+packets) and reads it three ways: a loop that polls INT_STATUS and
+FIFO_COUNT as fast as the bus allows, MPU6050Pipeline woken by edges of an
+I2CdevSimLine that a second thread triggers as each packet is written (the
+INT pin), and MPU6050Pipeline without an edge source, as a plain 5 ms
+poller. For each the packet rate, the latency from packet production to
+dispatch, lost packets, CPU time and I2C transactions per packet are
+printed. A last run stalls the consumer for 500 ms so that the FIFO
+overflows, and compares the packets missing from the sequence with what
+the driver's FIFO counters (MPU6050_Base::getFIFOStats()) report.
+No I2C hardware or GPIO is required.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile on a BeagleBone Black (or any Linux host)
+  1. then from bash
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ g++ -O2 -std=c++11 -pthread -o MPU6050_pipeline_sim ${PATH_I2CDEVLIB}BeagleBoneBlack/MPU6050/examples/MPU6050_pipeline_sim.cpp \
+         -I ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/I2Cdev.cpp \
+         ${PATH_I2CDEVLIB}BeagleBoneBlack/I2Cdev/I2CdevScheduler.cpp \
+         -I ${PATH_I2CDEVLIB}BeagleBoneBlack/MPU6050 ${PATH_I2CDEVLIB}BeagleBoneBlack/MPU6050/MPU6050_Pipeline.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/I2Cdev ${PATH_I2CDEVLIB}Arduino/I2Cdev/I2CdevConfig.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/MPU6050 ${PATH_I2CDEVLIB}Arduino/MPU6050/MPU6050.cpp \
+         ${PATH_I2CDEVLIB}Arduino/MPU6050/MPU6050_6Axis_MotionApps612.cpp
+      $ ./MPU6050_pipeline_sim [seconds]
+
+  On real hardware, replace the I2CdevSimLine with an I2CdevGpioLine for the
+  chip and line offset the INT pin is wired to, e.g. ("/dev/gpiochip0", 17).
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <atomic>
+#include <thread>
+#include "I2Cdev.h"
+#include "I2CdevScheduler.h"
+#include "MPU6050_6Axis_MotionApps612.h"
+#include "MPU6050_Pipeline.h"
+#include "MPU6050SimTransport.h"
+
+#define FALLBACK_POLL_US    5000
+#define STALL_AT_PACKET     50
+#define STALL_US            500000  // longer than the 1024 byte FIFO holds
+
+static MPU6050SimTransport bus(28);
+static MPU6050 mpu(MPU6050_DEFAULT_ADDRESS, &bus);
+
+// what the consumer saw during one run
+struct Received
+{
+  uint32_t packets;
+  uint32_t lost;     // gaps in the sequence numbers
+  uint64_t sumLatencyUs;
+  uint32_t maxLatencyUs;
+  int32_t lastSeq;
+  uint32_t stallUs;  // consumer blocks this long once, at packet STALL_AT_PACKET
+};
+
+static uint64_t cpuNs()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void sleepUntilNs(uint64_t ns)
+{
+  struct timespec ts;
+  ts.tv_sec = ns / 1000000000ULL;
+  ts.tv_nsec = ns % 1000000000ULL;
+  clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+}
+
+static void onPacket(const uint8_t *packet, uint16_t, uint64_t, void *arg)
+{
+  Received *r = (Received *)arg;
+  uint16_t seq = (packet[2] << 8) | packet[3];
+  uint32_t latencyUs = I2CdevScheduler::now() / 1000 - bus.producedAt(seq);
+  if (r->lastSeq >= 0)
+    r->lost += (uint16_t)(seq - r->lastSeq - 1);
+  r->lastSeq = seq;
+  r->packets++;
+  r->sumLatencyUs += latencyUs;
+  if (latencyUs > r->maxLatencyUs)
+    r->maxLatencyUs = latencyUs;
+  if (r->stallUs && r->packets == STALL_AT_PACKET)
+    sleepUntilNs(I2CdevScheduler::now() + r->stallUs * 1000ULL);
+}
+
+// raise the INT line whenever the DMP writes a packet
+static std::atomic<bool> triggering;
+static void triggerEdges(I2CdevSimLine *line)
+{
+  uint64_t next = bus.firstPacketAt() * 1000;
+  uint64_t now = I2CdevScheduler::now();
+  if (next < now)
+    next += ((now - next) / (SIM_PACKET_US * 1000ULL) + 1) * SIM_PACKET_US * 1000ULL;
+  while (triggering)
+  {
+    sleepUntilNs(next);
+    line->trigger(next);
+    next += SIM_PACKET_US * 1000ULL;
+  }
+}
+
+static void report(const char *name, const Received &r, uint64_t cpu, uint32_t transfers, int seconds)
+{
+  printf("  %-22s %6.1f packets/s, latency mean %5.2f ms max %5.2f ms, %3u lost, CPU %5.1f%%, %5.1f transactions/packet\n",
+         name, r.packets / (double)seconds, r.packets ? r.sumLatencyUs / 1000.0 / r.packets : 0.0,
+         r.maxLatencyUs / 1000.0, r.lost, 100.0 * cpu * 1e-9 / seconds, r.packets ? transfers / (double)r.packets : 0.0);
+}
+
+static void runBusyPoll(uint16_t packetSize, int seconds)
+{
+  Received r = { 0, 0, 0, 0, -1, 0 };
+  uint8_t buffer[MPU6050_PIPELINE_BUFFER_SIZE];
+
+  mpu.resetFIFO();
+  uint32_t transfers = bus.getTransferCount();
+  uint64_t cpu = cpuNs();
+  uint64_t end = I2CdevScheduler::now() + seconds * 1000000000ULL;
+  while (I2CdevScheduler::now() < end)
+  {
+    if (!(mpu.getIntStatus() & (1 << MPU6050_INTERRUPT_DMP_INT_BIT)))
+      continue;
+    uint16_t count = mpu.getFIFOCount() / packetSize;
+    if (!count)
+      continue;
+    mpu.getFIFOBytes(buffer, count * packetSize);
+    for (uint16_t p = 0; p < count; p++)
+      onPacket(buffer + p * packetSize, packetSize, 0, &r);
+  }
+  report("busy poll", r, cpuNs() - cpu, bus.getTransferCount() - transfers, seconds);
+}
+
+static void runPipeline(const char *name, uint16_t packetSize, bool edges, uint32_t stallUs, int seconds)
+{
+  Received r = { 0, 0, 0, 0, -1, stallUs };
+  I2CdevSimLine line;
+  MPU6050Pipeline pipeline(&mpu, packetSize, edges ? &line : 0, edges ? MPU6050_PIPELINE_POLL_US : FALLBACK_POLL_US);
+  pipeline.addConsumer(onPacket, &r);
+
+  mpu.resetFIFO();
+  mpu.resetFIFOStats();
+  uint32_t transfers = bus.getTransferCount();
+  uint64_t cpu = cpuNs();
+  triggering = edges;
+  std::thread trigger;
+  if (edges)
+    trigger = std::thread(triggerEdges, &line);
+  pipeline.start();
+  sleepUntilNs(I2CdevScheduler::now() + seconds * 1000000000ULL);
+  pipeline.stop();
+  triggering = false;
+  if (trigger.joinable())
+    trigger.join();
+  cpu = cpuNs() - cpu;
+  transfers = bus.getTransferCount() - transfers;
+
+  report(name, r, cpu, transfers, seconds);
+  MPU6050PipelineStats stats;
+  pipeline.getStats(&stats);
+  MPU6050FIFOStats fifo;
+  mpu.getFIFOStats(&fifo);
+  printf("  %-22s %u edges, %u polls, %u empty reads, %u reads\n", "",
+         stats.edges, stats.polls, stats.emptyReads, stats.reads);
+  printf("  %-22s FIFO: %u delivered, %u dropped (%u overwritten), %u overflows, %u resyncs, %u resets, %u invalid\n", "",
+         fifo.delivered, fifo.dropped, fifo.overwritten, fifo.overflows, fifo.resyncs, fifo.resets, fifo.invalid);
+}
+
+int main(int argc, char **argv)
+{
+  int seconds = argc > 1 ? atoi(argv[1]) : 3;
+
+  mpu.initialize();
+  if (!mpu.testConnection() || mpu.dmpInitialize() != 0)
+  {
+    fprintf(stderr, "DMP initialization failed\n");
+    return 1;
+  }
+  mpu.setDMPEnabled(true);
+  uint16_t packetSize = mpu.dmpGetFIFOPacketSize();
+
+  printf("%u Hz DMP packets of %u bytes:\n", 1000000 / SIM_PACKET_US, packetSize);
+  runBusyPoll(packetSize, seconds);
+  runPipeline("pipeline, INT edges", packetSize, true, 0, seconds);
+  runPipeline("pipeline, 5 ms poller", packetSize, false, 0, seconds);
+  printf("Consumer stalls for %u ms:\n", STALL_US / 1000);
+  runPipeline("pipeline, INT edges", packetSize, true, STALL_US, seconds);
+  return 0;
+}
@@ -146,6 +146,39 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
 	return length;
 }
 
+/** Read a run of bytes from a single data port register (e.g. MPU6050 FIFO_R_W).
+ * The register address and the whole read go out as one command link joined
+ * by a repeated start, so there is one address phase and no 255 byte limit.
+ * @param devAddr I2C slave device address
+ * @param regAddr Data port register to read from
+ * @param length Number of bytes to read (at most 32767, so the count fits the return value)
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure or a length above 32767)
+ */
+int16_t I2Cdev::readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+	i2c_cmd_handle_t cmd;
+	esp_err_t rc;
+
+	if(length == 0)
+		return 0;
+	if(length > 32767)
+		return -1;
+
+	cmd = i2c_cmd_link_create();
+	ESP_ERROR_CHECK(i2c_master_start(cmd));
+	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
+	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
+	ESP_ERROR_CHECK(i2c_master_start(cmd));
+	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_READ, 1));
+	ESP_ERROR_CHECK(i2c_master_read(cmd, data, length, I2C_MASTER_LAST_NACK));
+	ESP_ERROR_CHECK(i2c_master_stop(cmd));
+	rc = i2c_master_cmd_begin(I2C_NUM, cmd, (timeout ? timeout : 1000)/portTICK_PERIOD_MS);
+	i2c_cmd_link_delete(cmd);
+
+	return rc == ESP_OK ? length : -1;
+}
+
 bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
 
 	uint8_t data1[] = {(uint8_t)(data>>8), (uint8_t)(data & 0xff)};
@@ -252,6 +285,39 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
 }
 
 
+/** Write multiple words to a 16-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of words to write (not more than 127)
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data){
+	if(length == 0 || length > 127)
+		return false;
+
+	uint8_t buf[length * 2];
+	for(uint8_t i = 0; i < length; i++){
+		buf[2 * i] = (uint8_t)(data[i] >> 8);
+		buf[2 * i + 1] = (uint8_t)(data[i] & 0xff);
+	}
+	return writeBytes(devAddr, regAddr, length * 2, buf);
+}
+
+/** Write the bits selected by a mask in an 8-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param mask Bits to replace, already in position
+ * @param data New register value, only the bits in mask are used
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data){
+	uint8_t b = 0;
+	readByte(devAddr, regAddr, &b);
+	return writeByte(devAddr, regAddr, (b & ~mask) | (data & mask));
+}
+
+
 /**
  * read word
  * @param devAddr
@@ -267,4 +333,24 @@ int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16
 	return 0;
 }
 
+/** Read multiple words from a 16-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of words to read (not more than 127)
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of words read (-1 indicates failure)
+ */
+int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout){
+	if(length == 0 || length > 127)
+		return -1;
+
+	// read the big-endian bytes straight into data, then swap each word in place
+	uint8_t *raw = (uint8_t *)data;
+	readBytes(devAddr, regAddr, length * 2, raw, timeout);
+	for(uint8_t i = 0; i < length; i++)
+		data[i] = (uint16_t)((raw[2 * i] << 8) | raw[2 * i + 1]);
+	return length;
+}
+
 
@@ -0,0 +1,5 @@
+// I2Cdev library collection - register sequence tables, ESP-IDF adapter
+// Compiles the shared Arduino/I2Cdev/I2CdevConfig.cpp in this component, so that both
+// the CMake and the legacy make build pick it up.
+
+#include "../../../Arduino/I2Cdev/I2CdevConfig.cpp"
@@ -0,0 +1,91 @@
+// I2Cdev library collection - Arduino runtime shims for ESP-IDF
+// The little of the Arduino core that the shared drivers in the Arduino tree
+// use besides I2Cdev itself: millis()/micros()/delay(), PROGMEM access and a
+// Serial stand-in that prints to the console. Put this component's directory
+// ahead of Arduino/I2Cdev on the include path, so that I2Cdev.h is this
+// port's header.
+// Based on Arduino's I2Cdev by Jeff Rowberg <jeff@rowberg.net>
+//
+// Changelog:
+//      2026-10-19 - Initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEVPORT_H_
+#define _I2CDEVPORT_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#ifndef pgm_read_byte
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#endif
+
+#define DEC 10
+#define HEX 16
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+static inline uint32_t micros() { return (uint32_t)esp_timer_get_time(); }
+static inline uint32_t millis() { return (uint32_t)(esp_timer_get_time() / 1000); }
+
+// sleeps at least one tick, so short polling delays still yield to other tasks
+static inline void delay(uint32_t ms) {
+    TickType_t ticks = pdMS_TO_TICKS(ms);
+    vTaskDelay(ticks ? ticks : 1);
+}
+
+static inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+/** Subset of Arduino's Print used by the drivers (calibration progress,
+ * offset dumps and DEBUG output).
+ */
+class I2CdevConsole {
+    public:
+        void write(char c) { putchar(c); fflush(stdout); }
+        void print(const char *s) { fputs(s, stdout); }
+        void print(char c) { putchar(c); }
+        void print(long n, int base = DEC) { printf(base == HEX ? "%lX" : "%ld", n); }
+        void print(int n, int base = DEC) { print((long)n, base); }
+        void print(unsigned int n, int base = DEC) { print((long)n, base); }
+        void print(uint8_t n, int base = DEC) { print((long)n, base); }
+        void print(double f, int digits = 2) { printf("%.*f", digits, f); }
+        template<typename T> void println(T v) { print(v); putchar('\n'); }
+        template<typename T> void println(T v, int format) { print(v, format); putchar('\n'); }
+        void println() { putchar('\n'); }
+};
+
+static I2CdevConsole Serial __attribute__((unused));
+
+#endif /* _I2CDEVPORT_H_ */
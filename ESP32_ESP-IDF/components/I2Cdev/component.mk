@@ -7,4 +7,5 @@
 # please read the ESP-IDF documents if you need to do this.
 #
 
-COMPONENT_ADD_INCLUDEDIRS=.
\ No newline at end of file
+# Arduino/I2Cdev after this directory, so that I2Cdev.h is the ESP-IDF one
+COMPONENT_ADD_INCLUDEDIRS=. ../../../Arduino/I2Cdev
\ No newline at end of file
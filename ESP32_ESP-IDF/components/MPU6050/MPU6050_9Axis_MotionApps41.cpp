@@ -0,0 +1,5 @@
+// I2Cdev library collection - MPU6050 9-axis MotionApps 4.1, ESP-IDF adapter
+// Compiles the shared Arduino/MPU6050/MPU6050_9Axis_MotionApps41.cpp in this component, so that both
+// the CMake and the legacy make build pick it up.
+
+#include "../../../Arduino/MPU6050/MPU6050_9Axis_MotionApps41.cpp"
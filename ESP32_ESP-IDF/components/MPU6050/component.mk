@@ -7,4 +7,7 @@
 # please read the ESP-IDF documents if you need to do this.
 #
 
-COMPONENT_ADD_INCLUDEDIRS=.
\ No newline at end of file
+COMPONENT_ADD_INCLUDEDIRS=.
+
+# DMP FIFO rate 200 Hz / (1 + 0x13) = 10 Hz, matching the example's 100 ms poll
+CPPFLAGS += -DMPU6050_DMP_FIFO_RATE_DIVISOR=0x13
@@ -9,7 +9,6 @@
 #include <esp_err.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
-#include "MPU6050.h"
 #include "MPU6050_6Axis_MotionApps20.h"
 #include "sdkconfig.h"
 
@@ -76,8 +75,7 @@ void task_display(void*){
 	    }
 
 	    //Best result is to match with DMP refresh rate
-	    // Its last value in components/MPU6050/MPU6050_6Axis_MotionApps20.h file line 310
-	    // Now its 0x13, which means DMP is refreshed with 10Hz rate
+	    // It is set by MPU6050_DMP_FIFO_RATE_DIVISOR in components/MPU6050, now 0x13 = 10Hz
 		vTaskDelay(100/portTICK_PERIOD_MS);
 	}
 
@@ -173,10 +173,27 @@ int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint1
     count = i2c_read_timeout_us(i2c_default, devAddr, data_buf, length*2, false, timeout * 1000);
     for(int i=0; i<length; i++){
         data[i] = (data_buf[j] << 8) | data_buf[j+1];
-        j+2;
+        j += 2;
     }
 
-    return count;
+    return count < 0 ? count : count / 2;
+}
+
+/** Read a run of bytes from a single data port register (e.g. MPU6050 FIFO_R_W).
+ * The address write ends without a stop, so the read follows with a repeated
+ * start and the whole run is one transaction with one address phase.
+ * @param devAddr I2C slave device address
+ * @param regAddr Data port register to read from
+ * @param length Number of bytes to read (at most 32767, so the count fits the return value)
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure or a length above 32767)
+ */
+int16_t I2Cdev::readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint32_t timeout) {
+    if (length > 32767) return -1;
+    if (i2c_write_blocking(i2c_default, devAddr, &regAddr, 1, true) != 1) return -1;
+    int count = i2c_read_timeout_us(i2c_default, devAddr, data, length, false, timeout * 1000);
+    return count == length ? count : -1;
 }
 
 /** write a single bit in an 8-bit device register.
@@ -236,6 +253,22 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
     }
 }
 
+/** Write the bits selected by a mask in an 8-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param mask Bits to replace, already in position
+ * @param data New register value, only the bits in mask are used
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data) {
+    uint8_t b;
+    if (readByte(devAddr, regAddr, &b) != 0) {
+        return writeByte(devAddr, regAddr, (b & ~mask) | (data & mask));
+    } else {
+        return false;
+    }
+}
+
 /** Write multiple bits in a 16-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to write to
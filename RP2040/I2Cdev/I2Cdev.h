@@ -5,6 +5,8 @@
 //
 // Changelog:
 //		2021-09-29 - Initial port release by Gino Ipóliti.
+//		2026-10-19 - add Arduino I2Cdev signatures and writeMasked() so the shared Arduino/MPU6050 core builds
+//		2026-10-19 - add readStream() for long reads from data port registers, fix readWords()
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -42,6 +44,8 @@ THE SOFTWARE.
 
 // 1000ms default read timeout (modify with "I2Cdev::readTimeout = [ms];")
 #define I2CDEV_DEFAULT_READ_TIMEOUT     ((uint32_t)1000000) // RP2040 I2C functions with timeout use microseconds so we have to multiply by 10^3
+// largest chunk the shared drivers in the Arduino tree read at once into stack buffers
+#define I2CDEVLIB_WIRE_BUFFER_LENGTH    32
 
 class I2Cdev {
     public:
@@ -55,6 +59,7 @@ class I2Cdev {
         static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint32_t timeout=I2Cdev::readTimeout);
         static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint32_t timeout=I2Cdev::readTimeout);
         static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint32_t timeout=I2Cdev::readTimeout);
+        static int16_t readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint32_t timeout=I2Cdev::readTimeout);
 
         static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
         static bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
@@ -64,6 +69,25 @@ class I2Cdev {
         static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
         static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
         static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        static bool writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data);
+
+        // Arduino I2Cdev signatures, used by the shared drivers in the Arduino tree; wireObj is ignored
+        static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint32_t timeout, void * /*wireObj*/) { return readBit(devAddr, regAddr, bitNum, data, timeout); }
+        static int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint32_t timeout, void * /*wireObj*/) { return readBits(devAddr, regAddr, bitStart, length, data, timeout); }
+        static int8_t readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint32_t timeout, void * /*wireObj*/) { return readByte(devAddr, regAddr, data, timeout); }
+        static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint32_t timeout, void * /*wireObj*/) { return readWord(devAddr, regAddr, data, timeout); }
+        static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint32_t timeout, void * /*wireObj*/) { return readBytes(devAddr, regAddr, length, data, timeout); }
+        static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint32_t timeout, void * /*wireObj*/) { return readWords(devAddr, regAddr, length, data, timeout); }
+        static int16_t readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint32_t timeout, void * /*wireObj*/) { return readStream(devAddr, regAddr, length, data, timeout); }
+        static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data, void * /*wireObj*/) { return writeBit(devAddr, regAddr, bitNum, data); }
+        static bool writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data, void * /*wireObj*/) { return writeBits(devAddr, regAddr, bitStart, length, data); }
+        static bool writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data, void * /*wireObj*/) { return writeByte(devAddr, regAddr, data); }
+        static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data, void * /*wireObj*/) { return writeWord(devAddr, regAddr, data); }
+        static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void * /*wireObj*/) { return writeBytes(devAddr, regAddr, length, data); }
+        static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void * /*wireObj*/) { return writeWords(devAddr, regAddr, length, data); }
+        static bool writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data, void * /*wireObj*/) { return writeMasked(devAddr, regAddr, mask, data); }
+        // the bus runs at the rate given to i2c_init(), per-device limits are not tracked
+        static bool setDeviceClock(uint8_t /*devAddr*/, uint32_t /*clockHz*/, void * /*wireObj*/ = 0) { return false; }
 
         static uint32_t readTimeout;
 
@@ -30,11 +30,154 @@ THE SOFTWARE.
 #include "I2Cdev.h"
 #include <stdio.h>
 
+I2CdevBus I2Cdev::defaultBus(I2CDEV_BSC1, i2c_baudrate);
+uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
+
+// bcm2835 library I2C calls always go through bcm2835_bsc1, so selecting a
+// bus means pointing it at that controller's registers
+static volatile uint32_t *bsc1Base = 0;
+static I2CdevBus *currentBus = 0;
+static uint32_t currentBaudrate = 0;
+
+struct DeviceClock {
+  I2CdevBus *bus;
+  uint32_t clockHz; // 0 = free entry
+  I2CdevDeviceStats stats;
+  uint8_t devAddr;
+};
+
+static DeviceClock deviceClocks[I2CDEV_DEVICE_CLOCKS];
+static uint8_t deviceClockCount = 0;
+static DeviceClock *currentDevice = 0; // entry of the transaction in progress
+static uint64_t currentStart = 0;
+
+static DeviceClock *findDevice(uint8_t devAddr, I2CdevBus *bus) {
+  for (uint8_t i = 0; i < I2CDEV_DEVICE_CLOCKS; i++) {
+    DeviceClock *d = &deviceClocks[i];
+    if (d->clockHz && d->devAddr == devAddr && d->bus == bus) return d;
+  }
+  return 0;
+}
+
+/** Account for the transaction started by the last select().
+ * @param response bcm2835 reason code, passed through
+ * @param bytes Payload bytes moved
+ */
+static uint8_t finish(uint8_t response, uint16_t bytes) {
+  if (currentDevice) {
+    currentDevice->stats.transactions++;
+    if (response == BCM2835_I2C_REASON_OK) currentDevice->stats.bytes += bytes;
+    currentDevice->stats.micros += bcm2835_st_read() - currentStart;
+    currentDevice = 0;
+  }
+  return response;
+}
+
+/** Create a bus object for one BSC controller.
+ * Call begin() after I2Cdev::initialize() before using it.
+ * @param bsc Controller to use (I2CDEV_BSC0 or I2CDEV_BSC1)
+ * @param baudrate Bus clock in Hz
+ */
+I2CdevBus::I2CdevBus(uint8_t bsc, uint32_t baudrate) {
+  this->bsc = bsc;
+  this->baudrate = baudrate;
+  slaveAddress = -1;
+}
+
+/** Route the controller pins and apply the bus clock.
+ */
+void I2CdevBus::begin() {
+  if (bsc == I2CDEV_BSC0) {
+    bcm2835_gpio_fsel(0, BCM2835_GPIO_FSEL_ALT0); // GPIO 0, SDA0
+    bcm2835_gpio_fsel(1, BCM2835_GPIO_FSEL_ALT0); // GPIO 1, SCL0
+    I2Cdev::selectBus(this);
+  } else {
+    I2Cdev::selectBus(this);
+    bcm2835_i2c_begin();
+  }
+  setBaudrate(baudrate);
+  slaveAddress = -1;
+}
+
+/** Return the controller pins to GPIO inputs.
+ */
+void I2CdevBus::end() {
+  if (bsc == I2CDEV_BSC0) {
+    bcm2835_gpio_fsel(0, BCM2835_GPIO_FSEL_INPT);
+    bcm2835_gpio_fsel(1, BCM2835_GPIO_FSEL_INPT);
+  } else {
+    bcm2835_i2c_end();
+  }
+  slaveAddress = -1;
+}
+
+/** Change the bus clock.
+ * @param baudrate Bus clock in Hz
+ */
+void I2CdevBus::setBaudrate(uint32_t baudrate) {
+  this->baudrate = baudrate;
+  I2Cdev::selectBus(this);
+  bcm2835_i2c_set_baudrate(baudrate);
+  currentBaudrate = baudrate;
+}
+
+/** Forget the cached slave address, e.g. after calling bcm2835_i2c_* directly.
+ */
+void I2CdevBus::invalidateSlaveAddress() {
+  slaveAddress = -1;
+}
+
 I2Cdev::I2Cdev() { }
 
 void I2Cdev::initialize() {
   bcm2835_init();
+  bsc1Base = bcm2835_bsc1;
+  currentBus = &defaultBus;
   bcm2835_i2c_set_baudrate( i2c_baudrate  );
+  currentBaudrate = defaultBus.baudrate = i2c_baudrate;
+  defaultBus.slaveAddress = -1;
+}
+
+/** Point the bcm2835 library at a bus controller.
+ * Also reapplies the bus clock so the library's per-byte timeout matches the
+ * selected bus when two buses run at different speeds.
+ * @param bus Bus to use for following bcm2835_i2c_* calls
+ */
+void I2Cdev::selectBus(I2CdevBus *bus) {
+  if (bsc1Base == 0) bsc1Base = bcm2835_bsc1;
+  if (bus == currentBus) return;
+  bcm2835_bsc1 = (bus->bsc == I2CDEV_BSC0) ? bcm2835_bsc0 : bsc1Base;
+  currentBus = bus;
+  if (bus->baudrate != currentBaudrate) {
+    bcm2835_i2c_set_baudrate(bus->baudrate);
+    currentBaudrate = bus->baudrate;
+  }
+}
+
+/** Select the bus, clock and slave address for a transaction.
+ * The slave address register is only written when it differs from the
+ * address last used on that bus. Devices registered with setDeviceClock()
+ * run at their own clock if it is below the bus baudrate, all others at the
+ * bus baudrate; the clock divider is only rewritten when that changes.
+ * @param devAddr I2C slave device address
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
+ */
+void I2Cdev::select(uint8_t devAddr, void *wireObj) {
+  I2CdevBus *bus = wireObj ? (I2CdevBus *)wireObj : &defaultBus;
+  selectBus(bus);
+  if (deviceClockCount) {
+    currentDevice = findDevice(devAddr, bus);
+    uint32_t clockHz = currentDevice && currentDevice->clockHz < bus->baudrate ? currentDevice->clockHz : bus->baudrate;
+    if (clockHz != currentBaudrate) {
+      bcm2835_i2c_set_baudrate(clockHz);
+      currentBaudrate = clockHz;
+    }
+    if (currentDevice) currentStart = bcm2835_st_read();
+  }
+  if (bus->slaveAddress != devAddr) {
+    bcm2835_i2c_setSlaveAddress(devAddr);
+    bus->slaveAddress = devAddr;
+  }
 }
 
 /** Enable or disable I2C, 
@@ -42,10 +185,12 @@ void I2Cdev::initialize() {
  */
 void I2Cdev::enable(bool isEnabled) {
   if ( set_I2C_pins ){
+    selectBus(&defaultBus);
     if (isEnabled)
       bcm2835_i2c_end();
     else
       bcm2835_i2c_begin() ;
+    defaultBus.slaveAddress = -1;
   }
 }
 
@@ -61,12 +206,12 @@ char recvBuf[256];
  * @param data Container for single bit value
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data) {
-  bcm2835_i2c_setSlaveAddress(devAddr);
+int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, void *wireObj) {
+  select(devAddr, wireObj);
   sendBuf[0] = regAddr;
   uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1);
   *data = recvBuf[1] & (1 << bitNum);
-  return response == BCM2835_I2C_REASON_OK ;
+  return finish(response, 1) == BCM2835_I2C_REASON_OK;
 }
 
 /** Read multiple bits from an 8-bit device register.
@@ -75,15 +220,16 @@ int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @param bitStart First bit position to read (0-7)
  * @param length Number of bits to read (not more than 8)
  * @param data Container for right-aligned value (i.e. '101' read from any bitStart position will equal 0x05)
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data) {
+int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, void *wireObj) {
   // 01101001 read byte
   // 76543210 bit numbers
   //    xxx   args: bitStart=4, length=3
   //    010   masked
   //   -> 010 shifted
-  bcm2835_i2c_setSlaveAddress(devAddr);
+  select(devAddr, wireObj);
   sendBuf[0] = regAddr;
   uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1);
   uint8_t b = (uint8_t) recvBuf[0];
@@ -93,21 +239,22 @@ int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
     b >>= (bitStart - length + 1);
     *data = b;
   }
-  return response == BCM2835_I2C_REASON_OK;
+  return finish(response, 1) == BCM2835_I2C_REASON_OK;
 }
 
 /** Read single byte from an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
  * @param data Container for byte value read from device
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data) {
-  bcm2835_i2c_setSlaveAddress(devAddr);
+int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, void *wireObj) {
+  select(devAddr, wireObj);
   sendBuf[0] = regAddr;
   uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1);
   data[0] = (uint8_t) recvBuf[0];
-  return response == BCM2835_I2C_REASON_OK;
+  return finish(response, 1) == BCM2835_I2C_REASON_OK;
 }
 
 /** Read multiple bytes from an 8-bit device register.
@@ -115,17 +262,18 @@ int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data) {
  * @param regAddr First register regAddr to read from
  * @param length Number of bytes to read
  * @param data Buffer to store read data in
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
  * @return I2C_TransferReturn_TypeDef http://downloads.energymicro.com/documentation/doxygen/group__I2C.html
  */
-int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
-  bcm2835_i2c_setSlaveAddress(devAddr);
+int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj) {
+  select(devAddr, wireObj);
   sendBuf[0] = regAddr;
   uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, length);
   int i ;
   for (i = 0; i < length ; i++) {
     data[i] = (uint8_t) recvBuf[i];
   }
-  return response == BCM2835_I2C_REASON_OK;
+  return finish(response, length) == BCM2835_I2C_REASON_OK;
 }
 
 /** write a single bit in an 8-bit device register.
@@ -133,10 +281,11 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
  * @param regAddr Register regAddr to write to
  * @param bitNum Bit position to write (0-7)
  * @param value New bit value to write
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
-  bcm2835_i2c_setSlaveAddress(devAddr);
+bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data, void *wireObj) {
+  select(devAddr, wireObj);
   //first reading registery value
   sendBuf[0] = regAddr;
   uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1 );
@@ -146,7 +295,7 @@ bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
     sendBuf[1] = b ;
     response = bcm2835_i2c_write(sendBuf, 2);
   }
-  return response == BCM2835_I2C_REASON_OK;
+  return finish(response, 1) == BCM2835_I2C_REASON_OK;
 }
 
 /** Write multiple bits in an 8-bit device register.
@@ -155,9 +304,10 @@ bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t
  * @param bitStart First bit position to write (0-7)
  * @param length Number of bits to write (not more than 8)
  * @param data Right-aligned value to write
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
+bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data, void *wireObj) {
   //      010 value to write
   // 76543210 bit numbers
   //    xxx   args: bitStart=4, length=3
@@ -165,7 +315,7 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
   // 10101111 original value (sample)
   // 10100011 original & ~mask
   // 10101011 masked | value
-  bcm2835_i2c_setSlaveAddress(devAddr);
+  select(devAddr, wireObj);
   //first reading registery value
   sendBuf[0] = regAddr;
   uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1 );
@@ -179,35 +329,56 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
     sendBuf[1] = b ;
     response = bcm2835_i2c_write(sendBuf, 2);
     }
-  return response == BCM2835_I2C_REASON_OK;
+  return finish(response, 1) == BCM2835_I2C_REASON_OK;
+}
+
+/** Write the bits selected by a mask in an 8-bit device register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param mask Bits to replace, already in position
+ * @param data New register value, only the bits in mask are used
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data, void *wireObj) {
+  select(devAddr, wireObj);
+  sendBuf[0] = regAddr;
+  uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1 );
+  if ( response == BCM2835_I2C_REASON_OK ) {
+    sendBuf[1] = (recvBuf[0] & ~mask) | (data & mask);
+    response = bcm2835_i2c_write(sendBuf, 2);
+    }
+  return finish(response, 1) == BCM2835_I2C_REASON_OK;
 }
 
 /** Write single byte to an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register address to write to
  * @param data New byte value to write
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
  * @return Status of operation (true = success)
  */
-bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
-  bcm2835_i2c_setSlaveAddress(devAddr);
+bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data, void *wireObj) {
+  select(devAddr, wireObj);
   sendBuf[0] = regAddr;
   sendBuf[1] = data;
   uint8_t response = bcm2835_i2c_write(sendBuf, 2);
-  return response == BCM2835_I2C_REASON_OK ;
+  return finish(response, 1) == BCM2835_I2C_REASON_OK;
 }
 
 /** Read single word from a 16-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
  * @param data Container for word value read from device
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
  * @return Status of read operation (true = success)
  */
-int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data) {
-  bcm2835_i2c_setSlaveAddress(devAddr);
+int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, void *wireObj) {
+  select(devAddr, wireObj);
   sendBuf[0] = regAddr;
   uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 2 );
   data[0] = (recvBuf[0] << 8) | recvBuf[1] ;
-  return  response == BCM2835_I2C_REASON_OK ;
+  return finish(response, 2) == BCM2835_I2C_REASON_OK;
 }
 
 /** Read multiple words from a 16-bit device register.
@@ -215,41 +386,60 @@ int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data) {
  * @param regAddr First register regAddr to read from
  * @param length Number of words to read
  * @param data Buffer to store read data in
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
  * @return Number of words read (-1 indicates failure)
  */
-int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data) {
-  bcm2835_i2c_setSlaveAddress(devAddr);
+int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj) {
+  select(devAddr, wireObj);
   sendBuf[0] = regAddr;
   uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, length*2 );
   uint8_t i;
   for (i = 0; i < length; i++) {
     data[i] = (recvBuf[i*2] << 8) | recvBuf[i*2+1] ;
   }
-  return  response == BCM2835_I2C_REASON_OK ;
+  return finish(response, length*2) == BCM2835_I2C_REASON_OK;
+}
+
+/** Read a run of bytes from a single data port register (e.g. MPU6050 FIFO_R_W).
+ * The read lands straight in data as one repeated-start transaction, so
+ * there is a single address phase and no 255 byte limit.
+ * @param devAddr I2C slave device address
+ * @param regAddr Data port register to read from
+ * @param length Number of bytes to read (at most 32767, so the count fits the return value)
+ * @param data Buffer to store read data in
+ * @param wireObj I2CdevBus to use (0 for I2Cdev::defaultBus)
+ * @return Number of bytes read (-1 indicates failure or a length above 32767)
+ */
+int16_t I2Cdev::readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, void *wireObj) {
+  if (length > 32767) return -1;
+  select(devAddr, wireObj);
+  char reg = regAddr;
+  uint8_t response = bcm2835_i2c_write_read_rs(&reg, 1, (char *)data, length);
+  return finish(response, length) == BCM2835_I2C_REASON_OK ? length : -1;
 }
 
-bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
-  bcm2835_i2c_setSlaveAddress(devAddr);
+bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data, void *wireObj){
+  select(devAddr, wireObj);
   sendBuf[0] = regAddr;
   sendBuf[1] = (uint8_t) (data >> 8); //MSByte
   sendBuf[2] = (uint8_t) (data >> 0); //LSByte
   uint8_t response = bcm2835_i2c_write(sendBuf, 3);
-  return response == BCM2835_I2C_REASON_OK ;
+  return finish(response, 2) == BCM2835_I2C_REASON_OK;
 }
 
-bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
-  bcm2835_i2c_setSlaveAddress(devAddr);
+bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj){
+  select(devAddr, wireObj);
   sendBuf[0] = regAddr;
   uint8_t i;
   for (i = 0; i < length; i++) {
     sendBuf[i+1] = data[i] ;
   }
   uint8_t response = bcm2835_i2c_write(sendBuf, 1+length);
-  return response == BCM2835_I2C_REASON_OK ;
+  return finish(response, length) == BCM2835_I2C_REASON_OK;
 }
 
-bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data){
-  bcm2835_i2c_setSlaveAddress(devAddr);
+bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj){
+  select(devAddr, wireObj);
   sendBuf[0] = regAddr;
   uint8_t i;
   for (i = 0; i < length; i++) {
@@ -257,5 +447,92 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
     sendBuf[2+2*i] = (uint8_t) (data[i] >> 0); //LSByte
   }
   uint8_t response = bcm2835_i2c_write(sendBuf, 1+2*length);
-  return response == BCM2835_I2C_REASON_OK ;
+  return finish(response, length*2) == BCM2835_I2C_REASON_OK;
+}
+
+/** Set the fastest bus clock a device supports.
+ * The bus is lowered to that clock for the device's transactions and
+ * restored to the bus baudrate for everyone else, so a 100 kHz device does
+ * not hold back 400 kHz devices sharing the bus. A limit above the bus
+ * baudrate is never applied. Registered devices also get their
+ * traffic counted, see getDeviceStats().
+ * @param devAddr I2C slave device address
+ * @param clockHz Maximum clock in Hz (0 to remove the device's entry)
+ * @param wireObj I2CdevBus the device is on (0 for I2Cdev::defaultBus)
+ * @return True if the entry was stored, false if the table is full
+ *         (I2CDEV_DEVICE_CLOCKS entries)
+ */
+bool I2Cdev::setDeviceClock(uint8_t devAddr, uint32_t clockHz, void *wireObj) {
+  I2CdevBus *bus = wireObj ? (I2CdevBus *)wireObj : &defaultBus;
+  DeviceClock *d = findDevice(devAddr, bus);
+  if (!clockHz) {
+    if (d) {
+      d->clockHz = 0;
+      deviceClockCount--;
+    }
+    return true;
+  }
+  if (!d) {
+    for (uint8_t i = 0; !d && i < I2CDEV_DEVICE_CLOCKS; i++) {
+      if (!deviceClocks[i].clockHz) d = &deviceClocks[i];
+    }
+    if (!d) return false;
+    d->devAddr = devAddr;
+    d->bus = bus;
+    deviceClockCount++;
+  }
+  d->clockHz = clockHz;
+  memset(&d->stats, 0, sizeof(d->stats));
+  return true;
+}
+
+/** Get the clock used for a device's transactions.
+ * @param devAddr I2C slave device address
+ * @param wireObj I2CdevBus the device is on (0 for I2Cdev::defaultBus)
+ * @return Bus baudrate in Hz, or the device's limit from setDeviceClock() if that is lower
+ */
+uint32_t I2Cdev::getDeviceClock(uint8_t devAddr, void *wireObj) {
+  I2CdevBus *bus = wireObj ? (I2CdevBus *)wireObj : &defaultBus;
+  DeviceClock *d = findDevice(devAddr, bus);
+  return d && d->clockHz < bus->baudrate ? d->clockHz : bus->baudrate;
+}
+
+/** Set the clock for devices without a setDeviceClock() entry.
+ * Same as I2CdevBus::setBaudrate().
+ * @param clockHz Clock in Hz
+ * @param wireObj I2CdevBus to change (0 for I2Cdev::defaultBus)
+ */
+void I2Cdev::setBusClock(uint32_t clockHz, void *wireObj) {
+  (wireObj ? (I2CdevBus *)wireObj : &defaultBus)->setBaudrate(clockHz);
+}
+
+/** Get a registered device's traffic since setDeviceClock() or resetDeviceStats().
+ * @param devAddr I2C slave device address
+ * @param stats Receives a copy of the counters
+ * @param wireObj I2CdevBus the device is on (0 for I2Cdev::defaultBus)
+ * @return False if the device has no setDeviceClock() entry
+ */
+bool I2Cdev::getDeviceStats(uint8_t devAddr, I2CdevDeviceStats *stats, void *wireObj) {
+  DeviceClock *d = findDevice(devAddr, wireObj ? (I2CdevBus *)wireObj : &defaultBus);
+  if (!d) return false;
+  *stats = d->stats;
+  return true;
+}
+
+/** Get the data rate a registered device achieved while it had the bus.
+ * @param devAddr I2C slave device address
+ * @param wireObj I2CdevBus the device is on (0 for I2Cdev::defaultBus)
+ * @return Bytes per second of transaction time (0 if unknown)
+ */
+uint32_t I2Cdev::getDeviceThroughput(uint8_t devAddr, void *wireObj) {
+  I2CdevDeviceStats stats;
+  if (!getDeviceStats(devAddr, &stats, wireObj) || !stats.micros) return 0;
+  return (uint64_t)stats.bytes * 1000000 / stats.micros;
+}
+
+/** Clear the traffic counters of every registered device. */
+void I2Cdev::resetDeviceStats() {
+  for (uint8_t i = 0; i < I2CDEV_DEVICE_CLOCKS; i++) {
+    memset(&deviceClocks[i].stats, 0, sizeof(deviceClocks[i].stats));
+  }
 }
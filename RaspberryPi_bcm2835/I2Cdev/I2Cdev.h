@@ -47,30 +47,94 @@ THE SOFTWARE.
 #define i2c_baudrate 400000
 //uint32_t i2c_baudrate = 400000 ; //400 kHz, 
 
+#define I2CDEV_BSC0 0 // GPIO 0/1 (P1-27/P1-28 on 40-pin boards, P5 header on Rev2 B)
+#define I2CDEV_BSC1 1 // GPIO 2/3 (P1-03/P1-05), the default bus
+
+// kept for source compatibility with the Arduino I2Cdev, the bcm2835 library applies its own timeout
+#define I2CDEV_DEFAULT_READ_TIMEOUT 1000
+// largest single read the shared drivers should issue (readBytes() returns the
+// count as int8_t; the transfer buffers in I2Cdev.cpp hold 256 bytes)
+#define I2CDEVLIB_WIRE_BUFFER_LENGTH 127
+
+#define I2CDEV_DEVICE_CLOCKS 8
+
+/** Traffic of one device registered with I2Cdev::setDeviceClock(). */
+struct I2CdevDeviceStats {
+        uint32_t transactions;
+        uint32_t bytes;  // payload bytes moved, register addresses not included
+        uint32_t micros; // time spent in its transactions
+};
+
+/** One BSC (Broadcom Serial Controller) I2C master.
+ * Each bus remembers the slave address it last selected, so consecutive
+ * transactions to the same device skip the slave address register write.
+ * Pass a pointer to an I2CdevBus as the wireObj argument of any I2Cdev
+ * method (or of a device class constructor) to use that bus; a null wireObj
+ * uses I2Cdev::defaultBus (BSC1). Buses are not thread-safe.
+ */
+class I2CdevBus {
+    public:
+        I2CdevBus(uint8_t bsc=I2CDEV_BSC1, uint32_t baudrate=i2c_baudrate);
+
+        void begin();
+        void end();
+        void setBaudrate(uint32_t baudrate);
+        void invalidateSlaveAddress();
+
+        uint8_t bsc;
+        uint32_t baudrate;
+        int16_t slaveAddress; // -1 = unknown
+};
+
 class I2Cdev {
  public:
         I2Cdev();
 
         static void initialize();
         static void enable(bool isEnabled);
+        static void selectBus(I2CdevBus *bus);
 
-        static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data);
+        static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, void *wireObj=0);
         //TODO static int8_t readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data);
-        static int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data);
+        static int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, void *wireObj=0);
         //TODO static int8_t readBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t *data);
-        static int8_t readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data);
-        static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data);
-        static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
-        static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        static int8_t readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, void *wireObj=0);
+        static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, void *wireObj=0);
+        static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj=0);
+        static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj=0);
+        static int16_t readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, void *wireObj=0);
 
-        static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
+        static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data, void *wireObj=0);
         //TODO static bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
-        static bool writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data);
+        static bool writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data, void *wireObj=0);
         //TODO static bool writeBitsW(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint16_t data);
-        static bool writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data);
-        static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
-        static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
-        static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        static bool writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data, void *wireObj=0);
+        static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data, void *wireObj=0);
+        static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj=0);
+        static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj=0);
+        static bool writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t data, void *wireObj=0);
+
+        static bool setDeviceClock(uint8_t devAddr, uint32_t clockHz, void *wireObj=0);
+        static uint32_t getDeviceClock(uint8_t devAddr, void *wireObj=0);
+        static void setBusClock(uint32_t clockHz, void *wireObj=0);
+        static bool getDeviceStats(uint8_t devAddr, I2CdevDeviceStats *stats, void *wireObj=0);
+        static uint32_t getDeviceThroughput(uint8_t devAddr, void *wireObj=0);
+        static void resetDeviceStats();
+
+        // Arduino I2Cdev signatures, used by the shared drivers in the Arduino tree; timeout is ignored
+        static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t /*timeout*/, void *wireObj) { return readBit(devAddr, regAddr, bitNum, data, wireObj); }
+        static int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t /*timeout*/, void *wireObj) { return readBits(devAddr, regAddr, bitStart, length, data, wireObj); }
+        static int8_t readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t /*timeout*/, void *wireObj) { return readByte(devAddr, regAddr, data, wireObj); }
+        static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t /*timeout*/, void *wireObj) { return readWord(devAddr, regAddr, data, wireObj); }
+        static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t /*timeout*/, void *wireObj) { return readBytes(devAddr, regAddr, length, data, wireObj); }
+        static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t /*timeout*/, void *wireObj) { return readWords(devAddr, regAddr, length, data, wireObj); }
+        static int16_t readStream(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t /*timeout*/, void *wireObj) { return readStream(devAddr, regAddr, length, data, wireObj); }
+
+        static uint16_t readTimeout;
+        static I2CdevBus defaultBus;
+
+ private:
+        static void select(uint8_t devAddr, void *wireObj);
 };
 
 #endif /* _I2CDEV_H_ */
@@ -0,0 +1,493 @@
+// I2Cdev library collection - MPU6050 host-side sensor fusion
+// Mahony and Madgwick orientation filters for raw getMotion6/getMotion9 samples
+// RaspberryPi bcm2835 port, usable on any Linux host (no bcm2835 dependency)
+//
+// Filter equations follow the public reference implementations by
+// Sebastian Madgwick ("MahonyAHRS" and "MadgwickAHRS", 2011).
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "MPU6050_Fusion.h"
+
+#define DEG_TO_RAD_F 0.017453292519943295f
+
+static float invSqrt(float x) {
+    return 1.0f / sqrtf(x);
+}
+
+/** Default constructor.
+ * The filter starts at the identity orientation with the gyro scale for
+ * MPU6050_GYRO_FS_250, which is what MPU6050::initialize() configures.
+ * @param algorithm MPU6050_FUSION_MAHONY or MPU6050_FUSION_MADGWICK
+ */
+MPU6050_Fusion::MPU6050_Fusion(uint8_t algorithm) {
+    this -> algorithm = algorithm;
+    gyroScale = DEG_TO_RAD_F / MPU6050_FUSION_GYRO_LSB_PER_DPS;
+    twoKp = 2.0f * MPU6050_FUSION_DEFAULT_KP;
+    twoKi = 2.0f * MPU6050_FUSION_DEFAULT_KI;
+    beta = MPU6050_FUSION_DEFAULT_BETA;
+    reset();
+}
+
+/** Reset orientation to identity and clear the integral (gyro bias) terms.
+ */
+void MPU6050_Fusion::reset() {
+    q0 = 1.0f;
+    q1 = 0.0f;
+    q2 = 0.0f;
+    q3 = 0.0f;
+    integralFBx = 0.0f;
+    integralFBy = 0.0f;
+    integralFBz = 0.0f;
+}
+
+/** Get the active fusion algorithm.
+ * @return MPU6050_FUSION_MAHONY or MPU6050_FUSION_MADGWICK
+ */
+uint8_t MPU6050_Fusion::getAlgorithm() {
+    return algorithm;
+}
+/** Select the fusion algorithm. The current orientation estimate is kept.
+ * @param algorithm MPU6050_FUSION_MAHONY or MPU6050_FUSION_MADGWICK
+ */
+void MPU6050_Fusion::setAlgorithm(uint8_t algorithm) {
+    this -> algorithm = algorithm;
+}
+
+/** Set gyro scaling to match MPU6050::setFullScaleGyroRange().
+ * @param range New full-scale gyroscope range value (MPU6050_GYRO_FS_*)
+ */
+void MPU6050_Fusion::setFullScaleGyroRange(uint8_t range) {
+    setGyroSensitivity(MPU6050_FUSION_GYRO_LSB_PER_DPS / (1 << range));
+}
+/** Set gyro scaling directly, e.g. for MPU9250 or a calibrated device.
+ * @param lsbPerDegPerSec Raw gyro counts per degree/second
+ */
+void MPU6050_Fusion::setGyroSensitivity(float lsbPerDegPerSec) {
+    gyroScale = DEG_TO_RAD_F / lsbPerDegPerSec;
+}
+
+/** Set Mahony filter gains.
+ * @param kp Proportional gain (how fast accel/mag corrections are applied)
+ * @param ki Integral gain (gyro bias estimation, 0 to disable)
+ */
+void MPU6050_Fusion::setMahonyGains(float kp, float ki) {
+    twoKp = 2.0f * kp;
+    twoKi = 2.0f * ki;
+    if (twoKi == 0.0f) {
+        integralFBx = 0.0f;
+        integralFBy = 0.0f;
+        integralFBz = 0.0f;
+    }
+}
+/** Set Madgwick filter gain.
+ * @param beta Gradient descent step gain (larger converges faster, more noise)
+ */
+void MPU6050_Fusion::setMadgwickBeta(float beta) {
+    this -> beta = beta;
+}
+
+/** Update the estimate with one raw 6-axis sample.
+ * @param ax, ay, az Raw accelerometer values from getMotion6()
+ * @param gx, gy, gz Raw gyroscope values from getMotion6()
+ * @param dt Time since the previous sample in seconds
+ */
+void MPU6050_Fusion::update(int16_t ax, int16_t ay, int16_t az, int16_t gx, int16_t gy, int16_t gz, float dt) {
+    updateIMU(gx * gyroScale, gy * gyroScale, gz * gyroScale, ax, ay, az, dt);
+}
+/** Update the estimate with one raw 9-axis sample.
+ * The magnetometer axes must already be aligned to the accel/gyro frame (the
+ * AK8975/AK8963 inside MPU9150/MPU9250 has X and Y swapped and Z inverted).
+ * A sample with mx = my = mz = 0 is treated as "no magnetometer data".
+ * @param ax, ay, az Raw accelerometer values from getMotion9()
+ * @param gx, gy, gz Raw gyroscope values from getMotion9()
+ * @param mx, my, mz Raw magnetometer values from getMotion9()
+ * @param dt Time since the previous sample in seconds
+ */
+void MPU6050_Fusion::update(int16_t ax, int16_t ay, int16_t az, int16_t gx, int16_t gy, int16_t gz,
+                            int16_t mx, int16_t my, int16_t mz, float dt) {
+    updateAHRS(gx * gyroScale, gy * gyroScale, gz * gyroScale, ax, ay, az, mx, my, mz, dt);
+}
+
+/** Update the estimate with one 6-axis sample in physical units.
+ * @param gx, gy, gz Angular rate in rad/s
+ * @param ax, ay, az Acceleration in any unit (only the direction is used)
+ * @param dt Time since the previous sample in seconds
+ */
+void MPU6050_Fusion::updateIMU(float gx, float gy, float gz, float ax, float ay, float az, float dt) {
+    if (algorithm == MPU6050_FUSION_MADGWICK) {
+        madgwickIMU(gx, gy, gz, ax, ay, az, dt);
+    } else {
+        mahonyIMU(gx, gy, gz, ax, ay, az, dt);
+    }
+}
+/** Update the estimate with one 9-axis sample in physical units.
+ * @param gx, gy, gz Angular rate in rad/s
+ * @param ax, ay, az Acceleration in any unit (only the direction is used)
+ * @param mx, my, mz Magnetic field in any unit (only the direction is used)
+ * @param dt Time since the previous sample in seconds
+ */
+void MPU6050_Fusion::updateAHRS(float gx, float gy, float gz, float ax, float ay, float az,
+                                float mx, float my, float mz, float dt) {
+    if ((mx == 0.0f) && (my == 0.0f) && (mz == 0.0f)) {
+        updateIMU(gx, gy, gz, ax, ay, az, dt);
+    } else if (algorithm == MPU6050_FUSION_MADGWICK) {
+        madgwickAHRS(gx, gy, gz, ax, ay, az, mx, my, mz, dt);
+    } else {
+        mahonyAHRS(gx, gy, gz, ax, ay, az, mx, my, mz, dt);
+    }
+}
+
+/** Get the current orientation estimate.
+ * @param q Quaternion container (same convention as dmpGetQuaternion)
+ */
+void MPU6050_Fusion::getQuaternion(Quaternion *q) {
+    q -> w = q0;
+    q -> x = q1;
+    q -> y = q2;
+    q -> z = q3;
+}
+/** Get the estimated gravity direction in the sensor frame.
+ * @param v Vector container (same convention as dmpGetGravity)
+ */
+void MPU6050_Fusion::getGravity(VectorFloat *v) {
+    v -> x = 2 * (q1*q3 - q0*q2);
+    v -> y = 2 * (q0*q1 + q2*q3);
+    v -> z = q0*q0 - q1*q1 - q2*q2 + q3*q3;
+}
+/** Get yaw, pitch and roll in radians.
+ * @param data Array of 3 floats (same convention as dmpGetYawPitchRoll)
+ */
+void MPU6050_Fusion::getYawPitchRoll(float *data) {
+    VectorFloat gravity;
+    getGravity(&gravity);
+    // yaw: (about Z axis)
+    data[0] = atan2f(2*q1*q2 - 2*q0*q3, 2*q0*q0 + 2*q1*q1 - 1);
+    // pitch: (nose up/down, about Y axis)
+    data[1] = atan2f(gravity.x, sqrtf(gravity.y*gravity.y + gravity.z*gravity.z));
+    // roll: (tilt left/right, about X axis)
+    data[2] = atan2f(gravity.y, gravity.z);
+    if (gravity.z < 0) {
+        if (data[1] > 0) {
+            data[1] = (float)M_PI - data[1];
+        } else {
+            data[1] = (float)-M_PI - data[1];
+        }
+    }
+}
+
+void MPU6050_Fusion::mahonyIMU(float gx, float gy, float gz, float ax, float ay, float az, float dt) {
+    float recipNorm;
+    float halfvx, halfvy, halfvz;
+    float halfex, halfey, halfez;
+    float qa, qb, qc;
+
+    // only correct with the accelerometer if it measured something (avoids NaN)
+    if (!((ax == 0.0f) && (ay == 0.0f) && (az == 0.0f))) {
+        recipNorm = invSqrt(ax*ax + ay*ay + az*az);
+        ax *= recipNorm;
+        ay *= recipNorm;
+        az *= recipNorm;
+
+        // estimated direction of gravity (half magnitude)
+        halfvx = q1*q3 - q0*q2;
+        halfvy = q0*q1 + q2*q3;
+        halfvz = q0*q0 - 0.5f + q3*q3;
+
+        // error is the cross product between estimated and measured gravity
+        halfex = (ay*halfvz - az*halfvy);
+        halfey = (az*halfvx - ax*halfvz);
+        halfez = (ax*halfvy - ay*halfvx);
+
+        if (twoKi > 0.0f) {
+            integralFBx += twoKi * halfex * dt;
+            integralFBy += twoKi * halfey * dt;
+            integralFBz += twoKi * halfez * dt;
+            gx += integralFBx;
+            gy += integralFBy;
+            gz += integralFBz;
+        }
+
+        gx += twoKp * halfex;
+        gy += twoKp * halfey;
+        gz += twoKp * halfez;
+    }
+
+    // integrate rate of change of quaternion
+    gx *= (0.5f * dt);
+    gy *= (0.5f * dt);
+    gz *= (0.5f * dt);
+    qa = q0;
+    qb = q1;
+    qc = q2;
+    q0 += (-qb*gx - qc*gy - q3*gz);
+    q1 += (qa*gx + qc*gz - q3*gy);
+    q2 += (qa*gy - qb*gz + q3*gx);
+    q3 += (qa*gz + qb*gy - qc*gx);
+
+    recipNorm = invSqrt(q0*q0 + q1*q1 + q2*q2 + q3*q3);
+    q0 *= recipNorm;
+    q1 *= recipNorm;
+    q2 *= recipNorm;
+    q3 *= recipNorm;
+}
+
+void MPU6050_Fusion::mahonyAHRS(float gx, float gy, float gz, float ax, float ay, float az,
+                                float mx, float my, float mz, float dt) {
+    float recipNorm;
+    float q0q0, q0q1, q0q2, q0q3, q1q1, q1q2, q1q3, q2q2, q2q3, q3q3;
+    float hx, hy, bx, bz;
+    float halfvx, halfvy, halfvz, halfwx, halfwy, halfwz;
+    float halfex, halfey, halfez;
+    float qa, qb, qc;
+
+    if (!((ax == 0.0f) && (ay == 0.0f) && (az == 0.0f))) {
+        recipNorm = invSqrt(ax*ax + ay*ay + az*az);
+        ax *= recipNorm;
+        ay *= recipNorm;
+        az *= recipNorm;
+
+        recipNorm = invSqrt(mx*mx + my*my + mz*mz);
+        mx *= recipNorm;
+        my *= recipNorm;
+        mz *= recipNorm;
+
+        q0q0 = q0*q0;
+        q0q1 = q0*q1;
+        q0q2 = q0*q2;
+        q0q3 = q0*q3;
+        q1q1 = q1*q1;
+        q1q2 = q1*q2;
+        q1q3 = q1*q3;
+        q2q2 = q2*q2;
+        q2q3 = q2*q3;
+        q3q3 = q3*q3;
+
+        // reference direction of Earth's magnetic field
+        hx = 2.0f * (mx*(0.5f - q2q2 - q3q3) + my*(q1q2 - q0q3) + mz*(q1q3 + q0q2));
+        hy = 2.0f * (mx*(q1q2 + q0q3) + my*(0.5f - q1q1 - q3q3) + mz*(q2q3 - q0q1));
+        bx = sqrtf(hx*hx + hy*hy);
+        bz = 2.0f * (mx*(q1q3 - q0q2) + my*(q2q3 + q0q1) + mz*(0.5f - q1q1 - q2q2));
+
+        // estimated direction of gravity and magnetic field
+        halfvx = q1q3 - q0q2;
+        halfvy = q0q1 + q2q3;
+        halfvz = q0q0 - 0.5f + q3q3;
+        halfwx = bx*(0.5f - q2q2 - q3q3) + bz*(q1q3 - q0q2);
+        halfwy = bx*(q1q2 - q0q3) + bz*(q0q1 + q2q3);
+        halfwz = bx*(q0q2 + q1q3) + bz*(0.5f - q1q1 - q2q2);
+
+        // error is the sum of cross products between estimated and measured directions
+        halfex = (ay*halfvz - az*halfvy) + (my*halfwz - mz*halfwy);
+        halfey = (az*halfvx - ax*halfvz) + (mz*halfwx - mx*halfwz);
+        halfez = (ax*halfvy - ay*halfvx) + (mx*halfwy - my*halfwx);
+
+        if (twoKi > 0.0f) {
+            integralFBx += twoKi * halfex * dt;
+            integralFBy += twoKi * halfey * dt;
+            integralFBz += twoKi * halfez * dt;
+            gx += integralFBx;
+            gy += integralFBy;
+            gz += integralFBz;
+        }
+
+        gx += twoKp * halfex;
+        gy += twoKp * halfey;
+        gz += twoKp * halfez;
+    }
+
+    gx *= (0.5f * dt);
+    gy *= (0.5f * dt);
+    gz *= (0.5f * dt);
+    qa = q0;
+    qb = q1;
+    qc = q2;
+    q0 += (-qb*gx - qc*gy - q3*gz);
+    q1 += (qa*gx + qc*gz - q3*gy);
+    q2 += (qa*gy - qb*gz + q3*gx);
+    q3 += (qa*gz + qb*gy - qc*gx);
+
+    recipNorm = invSqrt(q0*q0 + q1*q1 + q2*q2 + q3*q3);
+    q0 *= recipNorm;
+    q1 *= recipNorm;
+    q2 *= recipNorm;
+    q3 *= recipNorm;
+}
+
+void MPU6050_Fusion::madgwickIMU(float gx, float gy, float gz, float ax, float ay, float az, float dt) {
+    float recipNorm;
+    float s0, s1, s2, s3;
+    float qDot1, qDot2, qDot3, qDot4;
+    float _2q0, _2q1, _2q2, _2q3, _4q0, _4q1, _4q2, _8q1, _8q2, q0q0, q1q1, q2q2, q3q3;
+
+    // rate of change of quaternion from gyroscope
+    qDot1 = 0.5f * (-q1*gx - q2*gy - q3*gz);
+    qDot2 = 0.5f * (q0*gx + q2*gz - q3*gy);
+    qDot3 = 0.5f * (q0*gy - q1*gz + q3*gx);
+    qDot4 = 0.5f * (q0*gz + q1*gy - q2*gx);
+
+    if (!((ax == 0.0f) && (ay == 0.0f) && (az == 0.0f))) {
+        recipNorm = invSqrt(ax*ax + ay*ay + az*az);
+        ax *= recipNorm;
+        ay *= recipNorm;
+        az *= recipNorm;
+
+        _2q0 = 2.0f * q0;
+        _2q1 = 2.0f * q1;
+        _2q2 = 2.0f * q2;
+        _2q3 = 2.0f * q3;
+        _4q0 = 4.0f * q0;
+        _4q1 = 4.0f * q1;
+        _4q2 = 4.0f * q2;
+        _8q1 = 8.0f * q1;
+        _8q2 = 8.0f * q2;
+        q0q0 = q0*q0;
+        q1q1 = q1*q1;
+        q2q2 = q2*q2;
+        q3q3 = q3*q3;
+
+        // gradient descent corrective step
+        s0 = _4q0*q2q2 + _2q2*ax + _4q0*q1q1 - _2q1*ay;
+        s1 = _4q1*q3q3 - _2q3*ax + 4.0f*q0q0*q1 - _2q0*ay - _4q1 + _8q1*q1q1 + _8q1*q2q2 + _4q1*az;
+        s2 = 4.0f*q0q0*q2 + _2q0*ax + _4q2*q3q3 - _2q3*ay - _4q2 + _8q2*q1q1 + _8q2*q2q2 + _4q2*az;
+        s3 = 4.0f*q1q1*q3 - _2q1*ax + 4.0f*q2q2*q3 - _2q2*ay;
+        recipNorm = s0*s0 + s1*s1 + s2*s2 + s3*s3;
+        if (recipNorm > 0.0f) {
+            recipNorm = invSqrt(recipNorm);
+            qDot1 -= beta * s0 * recipNorm;
+            qDot2 -= beta * s1 * recipNorm;
+            qDot3 -= beta * s2 * recipNorm;
+            qDot4 -= beta * s3 * recipNorm;
+        }
+    }
+
+    q0 += qDot1 * dt;
+    q1 += qDot2 * dt;
+    q2 += qDot3 * dt;
+    q3 += qDot4 * dt;
+
+    recipNorm = invSqrt(q0*q0 + q1*q1 + q2*q2 + q3*q3);
+    q0 *= recipNorm;
+    q1 *= recipNorm;
+    q2 *= recipNorm;
+    q3 *= recipNorm;
+}
+
+void MPU6050_Fusion::madgwickAHRS(float gx, float gy, float gz, float ax, float ay, float az,
+                                  float mx, float my, float mz, float dt) {
+    float recipNorm;
+    float s0, s1, s2, s3;
+    float qDot1, qDot2, qDot3, qDot4;
+    float hx, hy;
+    float _2q0mx, _2q0my, _2q0mz, _2q1mx, _2bx, _2bz, _4bx, _4bz, _2q0, _2q1, _2q2, _2q3, _2q0q2, _2q2q3;
+    float q0q0, q0q1, q0q2, q0q3, q1q1, q1q2, q1q3, q2q2, q2q3, q3q3;
+
+    qDot1 = 0.5f * (-q1*gx - q2*gy - q3*gz);
+    qDot2 = 0.5f * (q0*gx + q2*gz - q3*gy);
+    qDot3 = 0.5f * (q0*gy - q1*gz + q3*gx);
+    qDot4 = 0.5f * (q0*gz + q1*gy - q2*gx);
+
+    if (!((ax == 0.0f) && (ay == 0.0f) && (az == 0.0f))) {
+        recipNorm = invSqrt(ax*ax + ay*ay + az*az);
+        ax *= recipNorm;
+        ay *= recipNorm;
+        az *= recipNorm;
+
+        recipNorm = invSqrt(mx*mx + my*my + mz*mz);
+        mx *= recipNorm;
+        my *= recipNorm;
+        mz *= recipNorm;
+
+        _2q0mx = 2.0f * q0 * mx;
+        _2q0my = 2.0f * q0 * my;
+        _2q0mz = 2.0f * q0 * mz;
+        _2q1mx = 2.0f * q1 * mx;
+        _2q0 = 2.0f * q0;
+        _2q1 = 2.0f * q1;
+        _2q2 = 2.0f * q2;
+        _2q3 = 2.0f * q3;
+        _2q0q2 = 2.0f * q0 * q2;
+        _2q2q3 = 2.0f * q2 * q3;
+        q0q0 = q0*q0;
+        q0q1 = q0*q1;
+        q0q2 = q0*q2;
+        q0q3 = q0*q3;
+        q1q1 = q1*q1;
+        q1q2 = q1*q2;
+        q1q3 = q1*q3;
+        q2q2 = q2*q2;
+        q2q3 = q2*q3;
+        q3q3 = q3*q3;
+
+        // reference direction of Earth's magnetic field
+        hx = mx*q0q0 - _2q0my*q3 + _2q0mz*q2 + mx*q1q1 + _2q1*my*q2 + _2q1*mz*q3 - mx*q2q2 - mx*q3q3;
+        hy = _2q0mx*q3 + my*q0q0 - _2q0mz*q1 + _2q1mx*q2 - my*q1q1 + my*q2q2 + _2q2*mz*q3 - my*q3q3;
+        _2bx = sqrtf(hx*hx + hy*hy);
+        _2bz = -_2q0mx*q2 + _2q0my*q1 + mz*q0q0 + _2q1mx*q3 - mz*q1q1 + _2q2*my*q3 - mz*q2q2 + mz*q3q3;
+        _4bx = 2.0f * _2bx;
+        _4bz = 2.0f * _2bz;
+
+        // gradient descent corrective step
+        s0 = -_2q2*(2.0f*q1q3 - _2q0q2 - ax) + _2q1*(2.0f*q0q1 + _2q2q3 - ay)
+             - _2bz*q2*(_2bx*(0.5f - q2q2 - q3q3) + _2bz*(q1q3 - q0q2) - mx)
+             + (-_2bx*q3 + _2bz*q1)*(_2bx*(q1q2 - q0q3) + _2bz*(q0q1 + q2q3) - my)
+             + _2bx*q2*(_2bx*(q0q2 + q1q3) + _2bz*(0.5f - q1q1 - q2q2) - mz);
+        s1 = _2q3*(2.0f*q1q3 - _2q0q2 - ax) + _2q0*(2.0f*q0q1 + _2q2q3 - ay)
+             - 4.0f*q1*(1 - 2.0f*q1q1 - 2.0f*q2q2 - az)
+             + _2bz*q3*(_2bx*(0.5f - q2q2 - q3q3) + _2bz*(q1q3 - q0q2) - mx)
+             + (_2bx*q2 + _2bz*q0)*(_2bx*(q1q2 - q0q3) + _2bz*(q0q1 + q2q3) - my)
+             + (_2bx*q3 - _4bz*q1)*(_2bx*(q0q2 + q1q3) + _2bz*(0.5f - q1q1 - q2q2) - mz);
+        s2 = -_2q0*(2.0f*q1q3 - _2q0q2 - ax) + _2q3*(2.0f*q0q1 + _2q2q3 - ay)
+             - 4.0f*q2*(1 - 2.0f*q1q1 - 2.0f*q2q2 - az)
+             + (-_4bx*q2 - _2bz*q0)*(_2bx*(0.5f - q2q2 - q3q3) + _2bz*(q1q3 - q0q2) - mx)
+             + (_2bx*q1 + _2bz*q3)*(_2bx*(q1q2 - q0q3) + _2bz*(q0q1 + q2q3) - my)
+             + (_2bx*q0 - _4bz*q2)*(_2bx*(q0q2 + q1q3) + _2bz*(0.5f - q1q1 - q2q2) - mz);
+        s3 = _2q1*(2.0f*q1q3 - _2q0q2 - ax) + _2q2*(2.0f*q0q1 + _2q2q3 - ay)
+             + (-_4bx*q3 + _2bz*q1)*(_2bx*(0.5f - q2q2 - q3q3) + _2bz*(q1q3 - q0q2) - mx)
+             + (-_2bx*q0 + _2bz*q2)*(_2bx*(q1q2 - q0q3) + _2bz*(q0q1 + q2q3) - my)
+             + _2bx*q1*(_2bx*(q0q2 + q1q3) + _2bz*(0.5f - q1q1 - q2q2) - mz);
+        recipNorm = s0*s0 + s1*s1 + s2*s2 + s3*s3;
+        if (recipNorm > 0.0f) {
+            recipNorm = invSqrt(recipNorm);
+            qDot1 -= beta * s0 * recipNorm;
+            qDot2 -= beta * s1 * recipNorm;
+            qDot3 -= beta * s2 * recipNorm;
+            qDot4 -= beta * s3 * recipNorm;
+        }
+    }
+
+    q0 += qDot1 * dt;
+    q1 += qDot2 * dt;
+    q2 += qDot3 * dt;
+    q3 += qDot4 * dt;
+
+    recipNorm = invSqrt(q0*q0 + q1*q1 + q2*q2 + q3*q3);
+    q0 *= recipNorm;
+    q1 *= recipNorm;
+    q2 *= recipNorm;
+    q3 *= recipNorm;
+}
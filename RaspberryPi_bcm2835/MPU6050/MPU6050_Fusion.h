@@ -0,0 +1,91 @@
+// I2Cdev library collection - MPU6050 host-side sensor fusion
+// Mahony and Madgwick orientation filters for raw getMotion6/getMotion9 samples
+// RaspberryPi bcm2835 port, usable on any Linux host (no bcm2835 dependency)
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _MPU6050_FUSION_H_
+#define _MPU6050_FUSION_H_
+
+#include "helper_3dmath.h"
+
+#define MPU6050_FUSION_MAHONY       0
+#define MPU6050_FUSION_MADGWICK     1
+
+#define MPU6050_FUSION_DEFAULT_KP       0.5f    // Mahony proportional gain
+#define MPU6050_FUSION_DEFAULT_KI       0.0f    // Mahony integral gain (gyro bias estimation off)
+#define MPU6050_FUSION_DEFAULT_BETA     0.1f    // Madgwick gradient descent gain
+
+// gyro sensitivity at MPU6050_GYRO_FS_250, halved for each range step
+#define MPU6050_FUSION_GYRO_LSB_PER_DPS 131.0f
+
+class MPU6050_Fusion {
+    public:
+        MPU6050_Fusion(uint8_t algorithm=MPU6050_FUSION_MAHONY);
+
+        void reset();
+
+        uint8_t getAlgorithm();
+        void setAlgorithm(uint8_t algorithm);
+        void setFullScaleGyroRange(uint8_t range);
+        void setGyroSensitivity(float lsbPerDegPerSec);
+        void setMahonyGains(float kp, float ki);
+        void setMadgwickBeta(float beta);
+
+        // raw sample updates (units straight from getMotion6/getMotion9)
+        void update(int16_t ax, int16_t ay, int16_t az, int16_t gx, int16_t gy, int16_t gz, float dt);
+        void update(int16_t ax, int16_t ay, int16_t az, int16_t gx, int16_t gy, int16_t gz,
+                    int16_t mx, int16_t my, int16_t mz, float dt);
+
+        // physical unit updates (gyro in rad/s, accel and mag in any consistent unit)
+        void updateIMU(float gx, float gy, float gz, float ax, float ay, float az, float dt);
+        void updateAHRS(float gx, float gy, float gz, float ax, float ay, float az,
+                        float mx, float my, float mz, float dt);
+
+        // output in the same types and conventions as the MotionApps dmpGet* methods
+        void getQuaternion(Quaternion *q);
+        void getGravity(VectorFloat *v);
+        void getYawPitchRoll(float *data);
+
+    private:
+        void mahonyIMU(float gx, float gy, float gz, float ax, float ay, float az, float dt);
+        void mahonyAHRS(float gx, float gy, float gz, float ax, float ay, float az,
+                        float mx, float my, float mz, float dt);
+        void madgwickIMU(float gx, float gy, float gz, float ax, float ay, float az, float dt);
+        void madgwickAHRS(float gx, float gy, float gz, float ax, float ay, float az,
+                          float mx, float my, float mz, float dt);
+
+        uint8_t algorithm;
+        float gyroScale;    // raw LSB -> rad/s
+        float twoKp;
+        float twoKi;
+        float beta;
+        float q0, q1, q2, q3;
+        float integralFBx, integralFBy, integralFBz;
+};
+
+#endif /* _MPU6050_FUSION_H_ */
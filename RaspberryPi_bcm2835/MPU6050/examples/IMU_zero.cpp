@@ -32,7 +32,8 @@ To compile on a Raspberry Pi (1 or 2 or 3)
       $ PATH_I2CDEVLIB=~/i2cdevlib/
       $ gcc -o IMU_zero ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/examples/IMU_zero.cpp \
          -I ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/I2Cdev ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/I2Cdev/I2Cdev.cpp \
-         -I ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/ ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/MPU6050.cpp -l bcm2835 -l m
+         -I ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/ ${PATH_I2CDEVLIB}Arduino/MPU6050/MPU6050.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/I2Cdev ${PATH_I2CDEVLIB}Arduino/I2Cdev/I2CdevConfig.cpp -l bcm2835 -l m
       $ sudo ./IMU_zero
 
 If an MPU6050 
@@ -0,0 +1,71 @@
+/*
+I2Cdev library collection - MPU6050 RPi dual bus example
+Reads two MPU6050s at the same address, one on each BSC controller
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile on a Raspberry Pi
+  1. install the bcm2835 library, see http://www.airspayce.com/mikem/bcm2835/index.html
+  2. enable i2c on your RPi , see https://learn.adafruit.com/adafruits-raspberry-pi-lesson-4-gpio-setup/configuring-i2c
+  3. connect the first MPU6050 to SDA1/SCL1 (P1-03/P1-05) and the second to SDA0/SCL0 (GPIO 0/1)
+  4. then from bash
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ gcc -o MPU6050_dual_bus ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/examples/MPU6050_dual_bus.cpp \
+         -I ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/I2Cdev ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/I2Cdev/I2Cdev.cpp \
+         -I ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/ ${PATH_I2CDEVLIB}Arduino/MPU6050/MPU6050.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/I2Cdev ${PATH_I2CDEVLIB}Arduino/I2Cdev/I2CdevConfig.cpp -l bcm2835 -l m
+      $ sudo ./MPU6050_dual_bus
+
+*/
+
+#include <stdio.h>
+#include <bcm2835.h>
+#include "I2Cdev.h"
+#include "MPU6050.h"
+
+int main(int argc, char **argv) {
+  printf("MPU6050 dual bus example program\n");
+  I2Cdev::initialize();
+  I2CdevBus bus0(I2CDEV_BSC0, 400000);
+  bus0.begin();
+
+  MPU6050 imuA(MPU6050_DEFAULT_ADDRESS, &I2Cdev::defaultBus);
+  MPU6050 imuB(MPU6050_DEFAULT_ADDRESS, &bus0);
+  int16_t a[6], b[6];
+
+  if (!imuA.testConnection()) fprintf(stderr, "MPU6050 on BSC1 not responding\n");
+  if (!imuB.testConnection()) fprintf(stderr, "MPU6050 on BSC0 not responding\n");
+  imuA.initialize();
+  imuB.initialize();
+
+  printf("  A: ax \t ay \t az \t gx \t gy \t gz \t B: ax \t ay \t az \t gx \t gy \t gz\n");
+  while (true) {
+    imuA.getMotion6(&a[0], &a[1], &a[2], &a[3], &a[4], &a[5]);
+    imuB.getMotion6(&b[0], &b[1], &b[2], &b[3], &b[4], &b[5]);
+    printf("  %d \t %d \t %d \t %d \t %d \t %d \t %d \t %d \t %d \t %d \t %d \t %d\r",
+           a[0], a[1], a[2], a[3], a[4], a[5], b[0], b[1], b[2], b[3], b[4], b[5]);
+    fflush(stdout);
+    bcm2835_delay(100);
+  }
+  return 1;
+}
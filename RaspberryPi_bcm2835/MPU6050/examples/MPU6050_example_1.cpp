@@ -32,7 +32,8 @@ To compile on a Raspberry Pi (1 or 2)
       $ PATH_I2CDEVLIB=~/i2cdevlib/
       $ gcc -o MPU6050_example_1 ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/examples/MPU6050_example_1.cpp \
          -I ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/I2Cdev ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/I2Cdev/I2Cdev.cpp \
-         -I ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/ ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/MPU6050.cpp -l bcm2835 -l m
+         -I ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/ ${PATH_I2CDEVLIB}Arduino/MPU6050/MPU6050.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/I2Cdev ${PATH_I2CDEVLIB}Arduino/I2Cdev/I2CdevConfig.cpp -l bcm2835 -l m
       $ sudo ./MPU6050_example_1
 
 */
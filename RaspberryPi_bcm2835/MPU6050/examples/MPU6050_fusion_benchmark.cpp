@@ -0,0 +1,226 @@
+/*
+I2Cdev library collection - MPU6050_Fusion benchmark and accuracy check
+Measures filter updates/second for the Mahony and Madgwick algorithms and
+their orientation error, either against a synthetic motion profile (default)
+or against a recorded dataset. No sensor or bcm2835 library is required.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile on a Raspberry Pi (or any Linux host)
+  1. then from bash
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ g++ -O2 -o MPU6050_fusion_benchmark ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/examples/MPU6050_fusion_benchmark.cpp \
+         -I ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/ ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/MPU6050_Fusion.cpp -l m
+      $ ./MPU6050_fusion_benchmark [dataset.csv]
+
+Dataset format: one sample per line, comma separated, '#' lines ignored
+  dt,ax,ay,az,gx,gy,gz,mx,my,mz,qw,qx,qy,qz
+dt in seconds, raw getMotion9() values (gyro at +/- 250 deg/s, mag aligned to
+the accel frame, all zero if not available) and a reference quaternion, e.g.
+from a motion capture system.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "MPU6050_Fusion.h"
+
+#define SYNTHETIC_RATE_HZ   1000
+#define SYNTHETIC_SECONDS   60
+#define SETTLE_SECONDS      5
+#define BENCHMARK_UPDATES   2000000
+
+typedef struct {
+  float dt;
+  int16_t a[3], g[3], m[3];
+  Quaternion q;
+} Sample;
+
+static Sample *samples;
+static int sampleCount;
+
+static double nowSec() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static float noise(float amplitude) {
+  return amplitude * (2.0f * rand() / RAND_MAX - 1.0f);
+}
+
+static int16_t clamp16(float v) {
+  if (v > 32767) return 32767;
+  if (v < -32768) return -32768;
+  return (int16_t)v;
+}
+
+// rotate an earth-frame vector into the sensor frame: conj(q) * v * q
+static VectorFloat toSensor(Quaternion q, VectorFloat v) {
+  Quaternion p(0, v.x, v.y, v.z);
+  p = q.getConjugate().getProduct(p).getProduct(q);
+  return VectorFloat(p.x, p.y, p.z);
+}
+
+static void makeSynthetic() {
+  float dt = 1.0f / SYNTHETIC_RATE_HZ;
+  VectorFloat gravity(0, 0, 1);
+  VectorFloat field(0.5f, 0, -0.85f); // mid-latitude inclination
+  Quaternion q;
+
+  sampleCount = SYNTHETIC_RATE_HZ * SYNTHETIC_SECONDS;
+  samples = (Sample *)malloc(sampleCount * sizeof(Sample));
+  for (int i = 0; i < sampleCount; i++) {
+    float t = i * dt;
+    // smooth body-frame rotation in rad/s, well inside +/- 250 deg/s
+    float w[3] = { 1.2f * sinf(0.5f * t), 0.8f * cosf(0.3f * t), 0.6f * sinf(0.2f * t + 1.0f) };
+
+    Quaternion dq(1, 0.5f * w[0] * dt, 0.5f * w[1] * dt, 0.5f * w[2] * dt);
+    q = q.getProduct(dq).getNormalized();
+
+    VectorFloat a = toSensor(q, gravity);
+    VectorFloat m = toSensor(q, field);
+    samples[i].dt = dt;
+    for (int k = 0; k < 3; k++) {
+      float gk = w[k] * 57.29578f * 131.0f + 20.0f + noise(8.0f); // constant bias + noise
+      samples[i].g[k] = clamp16(gk);
+    }
+    samples[i].a[0] = clamp16(a.x * 16384 + noise(80));
+    samples[i].a[1] = clamp16(a.y * 16384 + noise(80));
+    samples[i].a[2] = clamp16(a.z * 16384 + noise(80));
+    samples[i].m[0] = clamp16(m.x * 300 + noise(3));
+    samples[i].m[1] = clamp16(m.y * 300 + noise(3));
+    samples[i].m[2] = clamp16(m.z * 300 + noise(3));
+    samples[i].q = q;
+  }
+}
+
+static int loadDataset(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (f == NULL) {
+    perror(path);
+    return 0;
+  }
+  int capacity = 1024;
+  char line[512];
+  samples = (Sample *)malloc(capacity * sizeof(Sample));
+  sampleCount = 0;
+  while (fgets(line, sizeof(line), f) != NULL) {
+    Sample s;
+    int v[9];
+    if (line[0] == '#') continue;
+    if (sscanf(line, "%f,%d,%d,%d,%d,%d,%d,%d,%d,%d,%f,%f,%f,%f", &s.dt,
+               &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6], &v[7], &v[8],
+               &s.q.w, &s.q.x, &s.q.y, &s.q.z) != 14) continue;
+    for (int k = 0; k < 3; k++) {
+      s.a[k] = v[k];
+      s.g[k] = v[3 + k];
+      s.m[k] = v[6 + k];
+    }
+    if (sampleCount == capacity) {
+      capacity *= 2;
+      samples = (Sample *)realloc(samples, capacity * sizeof(Sample));
+    }
+    samples[sampleCount++] = s;
+  }
+  fclose(f);
+  return sampleCount;
+}
+
+// angle in degrees between two gravity estimates (tilt error, yaw-independent)
+static float tiltError(Quaternion a, Quaternion b) {
+  VectorFloat ga = toSensor(a, VectorFloat(0, 0, 1));
+  VectorFloat gb = toSensor(b, VectorFloat(0, 0, 1));
+  float d = ga.x * gb.x + ga.y * gb.y + ga.z * gb.z;
+  if (d > 1) d = 1;
+  return acosf(d) * 57.29578f;
+}
+
+// full rotation angle in degrees between two orientations
+static float attitudeError(Quaternion a, Quaternion b) {
+  float d = fabsf(a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z);
+  if (d > 1) d = 1;
+  return 2 * acosf(d) * 57.29578f;
+}
+
+static void evaluate(const char *name, uint8_t algorithm, bool useMag) {
+  MPU6050_Fusion fusion(algorithm);
+  fusion.setMahonyGains(0.5f, 0.05f);
+  double sumSq = 0, maxErr = 0;
+  int counted = 0;
+  float t = 0;
+  Quaternion q;
+
+  for (int i = 0; i < sampleCount; i++) {
+    Sample *s = &samples[i];
+    if (useMag) {
+      fusion.update(s->a[0], s->a[1], s->a[2], s->g[0], s->g[1], s->g[2], s->m[0], s->m[1], s->m[2], s->dt);
+    } else {
+      fusion.update(s->a[0], s->a[1], s->a[2], s->g[0], s->g[1], s->g[2], s->dt);
+    }
+    t += s->dt;
+    if (t < SETTLE_SECONDS) continue;
+    fusion.getQuaternion(&q);
+    float e = useMag ? attitudeError(q, s->q) : tiltError(q, s->q);
+    sumSq += e * e;
+    if (e > maxErr) maxErr = e;
+    counted++;
+  }
+
+  // throughput: replay the data set until BENCHMARK_UPDATES updates have run
+  double t0 = nowSec();
+  for (int n = 0; n < BENCHMARK_UPDATES; n++) {
+    Sample *s = &samples[n % sampleCount];
+    if (useMag) {
+      fusion.update(s->a[0], s->a[1], s->a[2], s->g[0], s->g[1], s->g[2], s->m[0], s->m[1], s->m[2], s->dt);
+    } else {
+      fusion.update(s->a[0], s->a[1], s->a[2], s->g[0], s->g[1], s->g[2], s->dt);
+    }
+  }
+  double elapsed = nowSec() - t0;
+  fusion.getQuaternion(&q); // keep the optimizer honest
+
+  printf("%-10s %-6s %12.0f %10.3f %10.3f  (%s error)\n", name, useMag ? "9-axis" : "6-axis",
+         BENCHMARK_UPDATES / elapsed, counted ? sqrt(sumSq / counted) : 0.0, maxErr,
+         useMag ? "attitude" : "tilt");
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1) {
+    if (!loadDataset(argv[1])) return 1;
+    printf("Loaded %d samples from %s\n", sampleCount, argv[1]);
+  } else {
+    srand(1);
+    makeSynthetic();
+    printf("Synthetic profile: %d samples at %d Hz\n", sampleCount, SYNTHETIC_RATE_HZ);
+  }
+  printf("%-10s %-6s %12s %10s %10s\n", "filter", "input", "updates/s", "RMS deg", "max deg");
+  evaluate("Mahony", MPU6050_FUSION_MAHONY, false);
+  evaluate("Madgwick", MPU6050_FUSION_MADGWICK, false);
+  evaluate("Mahony", MPU6050_FUSION_MAHONY, true);
+  evaluate("Madgwick", MPU6050_FUSION_MADGWICK, true);
+  free(samples);
+  return 0;
+}
@@ -0,0 +1,279 @@
+/*
+I2Cdev library collection - helper_3dmath batch conversion benchmark
+Compares per-sample cost of the single-sample (AoS) orientation conversions
+against the QuaternionArray/VectorFloatArray/VectorInt16Array (SoA) batch
+versions for N = 1..1024 samples, on random orientations and on a slow
+tumble through known attitudes quantised like DMP packets. The batch
+yaw/pitch/roll is then checked for accuracy against a double-precision
+evaluation and, on the tumble, against the true pitch and roll. A capture
+of real packets can be checked the same way: a text file with one sample
+per line, "qw qx qy qz ax ay az" as returned by dmpGetQuaternion(int16_t *)
+and dmpGetAccel(int16_t *), lines starting with # ignored.
+No sensor or bcm2835 library is required.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile on a Raspberry Pi (or any Linux host)
+  1. then from bash
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ g++ -O3 -o helper_3dmath_batch_benchmark ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/examples/helper_3dmath_batch_benchmark.cpp \
+         -I ${PATH_I2CDEVLIB}RaspberryPi_bcm2835/MPU6050/ -l m
+      $ ./helper_3dmath_batch_benchmark [capture.txt]
+  (add -ffast-math to let the compiler vectorize atan2f/sqrtf in the yaw/pitch/roll loop as well)
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "helper_3dmath.h"
+
+#define MAX_SAMPLES 1024
+#define MIN_SAMPLES_PER_RUN 1000000
+#define TUMBLE_SAMPLES 256
+#define DMP_QUAT_ONE 16384.0    // dmpGetQuaternion(int16_t *) value of 1.0
+#define DMP_ACCEL_ONE_G 8192.0  // dmpGetAccel() value of 1 g
+#define MAX_ERROR_DOUBLE 1e-4   // rad, float batch math against double
+#define MAX_ERROR_TRUE 2e-3     // rad, including the 16-bit quaternion quantisation
+
+static float qw[MAX_SAMPLES], qx[MAX_SAMPLES], qy[MAX_SAMPLES], qz[MAX_SAMPLES];
+static float gx[MAX_SAMPLES], gy[MAX_SAMPLES], gz[MAX_SAMPLES];
+static float yaw[MAX_SAMPLES], pitch[MAX_SAMPLES], roll[MAX_SAMPLES];
+static int16_t ax[MAX_SAMPLES], ay[MAX_SAMPLES], az[MAX_SAMPLES];
+static int16_t wx[MAX_SAMPLES], wy[MAX_SAMPLES], wz[MAX_SAMPLES];
+
+static Quaternion qAoS[MAX_SAMPLES];
+static VectorInt16 aAoS[MAX_SAMPLES];
+static VectorInt16 wAoS[MAX_SAMPLES];
+static VectorFloat gAoS[MAX_SAMPLES];
+static float yprAoS[MAX_SAMPLES][3];
+static float truePitch[MAX_SAMPLES], trueRoll[MAX_SAMPLES];
+
+static double nowNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// same math as MotionApps dmpGetGravity/dmpGetYawPitchRoll/dmpGetLinearAccelInWorld
+static void convertAoS(int n) {
+  for (int i = 0; i < n; i++) {
+    Quaternion *q = &qAoS[i];
+    VectorFloat *g = &gAoS[i];
+    g -> x = 2 * (q -> x*q -> z - q -> w*q -> y);
+    g -> y = 2 * (q -> w*q -> x + q -> y*q -> z);
+    g -> z = q -> w*q -> w - q -> x*q -> x - q -> y*q -> y + q -> z*q -> z;
+
+    yprAoS[i][0] = atan2(2*q -> x*q -> y - 2*q -> w*q -> z, 2*q -> w*q -> w + 2*q -> x*q -> x - 1);
+    yprAoS[i][1] = atan2(g -> x , sqrt(g -> y*g -> y + g -> z*g -> z));
+    yprAoS[i][2] = atan2(g -> y , g -> z);
+    if (g -> z < 0) {
+      if (yprAoS[i][1] > 0) yprAoS[i][1] = M_PI - yprAoS[i][1];
+      else yprAoS[i][1] = -M_PI - yprAoS[i][1];
+    }
+
+    wAoS[i] = aAoS[i];
+    wAoS[i].rotate(q);
+  }
+}
+
+static void convertSoA(int n) {
+  QuaternionArray q(qw, qx, qy, qz);
+  VectorFloatArray g(gx, gy, gz);
+  VectorFloatArray ypr(yaw, pitch, roll);
+  VectorInt16Array a(ax, ay, az);
+  VectorInt16Array w(wx, wy, wz);
+  g.setGravity(&q, n);
+  ypr.setYawPitchRoll(&q, &g, n);
+  w.rotate(&a, &q, n);
+}
+
+static void setSample(int i, Quaternion q, VectorInt16 a) {
+  qAoS[i] = q;
+  qw[i] = q.w; qx[i] = q.x; qy[i] = q.y; qz[i] = q.z;
+  aAoS[i] = a;
+  ax[i] = a.x; ay[i] = a.y; az[i] = a.z;
+}
+
+static void setDMPSample(int i, const int16_t *quat, const int16_t *accel) {
+  setSample(i, Quaternion(quat[0] / DMP_QUAT_ONE, quat[1] / DMP_QUAT_ONE, quat[2] / DMP_QUAT_ONE, quat[3] / DMP_QUAT_ONE),
+            VectorInt16(accel[0], accel[1], accel[2]));
+}
+
+static int loadRandom() {
+  srand(1);
+  for (int i = 0; i < MAX_SAMPLES; i++) {
+    Quaternion q((float)rand() / RAND_MAX - 0.5f, (float)rand() / RAND_MAX - 0.5f,
+                 (float)rand() / RAND_MAX - 0.5f, (float)rand() / RAND_MAX - 0.5f);
+    q.normalize();
+    setSample(i, q, VectorInt16(rand() % 16384 - 8192, rand() % 16384 - 8192, rand() % 16384 - 8192));
+  }
+  return MAX_SAMPLES;
+}
+
+// one turn of yaw while pitch and roll swing through +-80 degrees, as the
+// DMP would report it: Z-Y-X attitude, 16-bit quaternion, gravity in accel
+static int loadTumble() {
+  for (int i = 0; i < TUMBLE_SAMPLES; i++) {
+    double t = (i + 0.5) / TUMBLE_SAMPLES;
+    double yaw = M_PI * (2 * t - 1);
+    double pitch = 80 * M_PI / 180 * sin(2 * M_PI * 3 * t);
+    double roll = 80 * M_PI / 180 * sin(2 * M_PI * 5 * t + 1);
+    double cy = cos(yaw / 2), sy = sin(yaw / 2), cp = cos(pitch / 2), sp = sin(pitch / 2);
+    double cr = cos(roll / 2), sr = sin(roll / 2);
+    int16_t quat[4] = {
+      (int16_t)lround(DMP_QUAT_ONE * (cr * cp * cy + sr * sp * sy)),
+      (int16_t)lround(DMP_QUAT_ONE * (sr * cp * cy - cr * sp * sy)),
+      (int16_t)lround(DMP_QUAT_ONE * (cr * sp * cy + sr * cp * sy)),
+      (int16_t)lround(DMP_QUAT_ONE * (cr * cp * sy - sr * sp * cy)) };
+    int16_t accel[3] = {
+      (int16_t)lround(-DMP_ACCEL_ONE_G * sin(pitch)),
+      (int16_t)lround(DMP_ACCEL_ONE_G * sin(roll) * cos(pitch)),
+      (int16_t)lround(DMP_ACCEL_ONE_G * cos(roll) * cos(pitch)) };
+    setDMPSample(i, quat, accel);
+    // dmpGetYawPitchRoll() reports pitch with the opposite sign
+    truePitch[i] = -pitch;
+    trueRoll[i] = roll;
+  }
+  return TUMBLE_SAMPLES;
+}
+
+static int loadCapture(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    perror(path);
+    return 0;
+  }
+  char line[128];
+  int n = 0;
+  while (n < MAX_SAMPLES && fgets(line, sizeof(line), f)) {
+    int v[7];
+    if (line[0] == '#' || sscanf(line, "%d %d %d %d %d %d %d", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6]) != 7)
+      continue;
+    int16_t quat[4] = { (int16_t)v[0], (int16_t)v[1], (int16_t)v[2], (int16_t)v[3] };
+    int16_t accel[3] = { (int16_t)v[4], (int16_t)v[5], (int16_t)v[6] };
+    setDMPSample(n++, quat, accel);
+  }
+  fclose(f);
+  return n;
+}
+
+// fill the rest of the buffers by repeating the first n samples
+static void repeatSamples(int n) {
+  for (int i = n; i < MAX_SAMPLES; i++) {
+    setSample(i, qAoS[i % n], aAoS[i % n]);
+    truePitch[i] = truePitch[i % n];
+    trueRoll[i] = trueRoll[i % n];
+  }
+}
+
+static double angleError(double a, double b) {
+  return fabs(remainder(a - b, 2 * M_PI));
+}
+
+static void runTimings(const char *name) {
+  printf("%s:\n", name);
+  printf("%6s %14s %14s %8s\n", "N", "AoS ns/sample", "SoA ns/sample", "speedup");
+  for (int n = 1; n <= MAX_SAMPLES; n *= 2) {
+    int runs = MIN_SAMPLES_PER_RUN / n;
+    double t0 = nowNs();
+    for (int r = 0; r < runs; r++) convertAoS(n);
+    double t1 = nowNs();
+    for (int r = 0; r < runs; r++) convertSoA(n);
+    double t2 = nowNs();
+    double aos = (t1 - t0) / ((double)runs * n);
+    double soa = (t2 - t1) / ((double)runs * n);
+    printf("%6d %14.2f %14.2f %7.2fx\n", n, aos, soa, aos / soa);
+  }
+}
+
+// batch results must agree with the single-sample path
+static int countMismatches() {
+  int mismatches = 0;
+  for (int i = 0; i < MAX_SAMPLES; i++) {
+    if (fabs(gx[i] - gAoS[i].x) > 1e-5f || fabs(gz[i] - gAoS[i].z) > 1e-5f) mismatches++;
+    if (fabs(pitch[i] - yprAoS[i][1]) > 1e-4f || fabs(yaw[i] - yprAoS[i][0]) > 1e-4f) mismatches++;
+    if (abs(wx[i] - wAoS[i].x) > 1 || abs(wy[i] - wAoS[i].y) > 1 || abs(wz[i] - wAoS[i].z) > 1) mismatches++;
+  }
+  printf("%d mismatches between AoS and SoA results\n", mismatches);
+  return mismatches;
+}
+
+// batch yaw/pitch/roll of the first n samples against the same formulas in
+// double precision and, where known, against the true attitude
+static bool checkAccuracy(const char *name, int n, bool known) {
+  convertSoA(n);
+  double maxYaw = 0, maxPitch = 0, maxRoll = 0, maxTrue = 0;
+  for (int i = 0; i < n; i++) {
+    double w = qw[i], x = qx[i], y = qy[i], z = qz[i];
+    double vx = 2 * (x * z - w * y), vy = 2 * (w * x + y * z), vz = w * w - x * x - y * y + z * z;
+    double refYaw = atan2(2 * x * y - 2 * w * z, 2 * w * w + 2 * x * x - 1);
+    double refPitch = atan2(vx, sqrt(vy * vy + vz * vz));
+    double refRoll = atan2(vy, vz);
+    if (vz < 0) refPitch = (refPitch > 0 ? M_PI : -M_PI) - refPitch;
+    maxYaw = fmax(maxYaw, angleError(yaw[i], refYaw));
+    maxPitch = fmax(maxPitch, angleError(pitch[i], refPitch));
+    maxRoll = fmax(maxRoll, angleError(roll[i], refRoll));
+    if (known) {
+      maxTrue = fmax(maxTrue, angleError(pitch[i], truePitch[i]));
+      maxTrue = fmax(maxTrue, angleError(roll[i], trueRoll[i]));
+    }
+  }
+  bool ok = maxYaw <= MAX_ERROR_DOUBLE && maxPitch <= MAX_ERROR_DOUBLE && maxRoll <= MAX_ERROR_DOUBLE;
+  printf("%s, %d samples: max error against double yaw %.2e pitch %.2e roll %.2e rad", name, n, maxYaw, maxPitch, maxRoll);
+  if (known) {
+    ok = ok && maxTrue <= MAX_ERROR_TRUE;
+    printf(", against the true pitch/roll %.2e rad", maxTrue);
+  }
+  printf(" (%s)\n", ok ? "ok" : "FAIL");
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  if (argc > 2) {
+    fprintf(stderr, "usage: %s [capture.txt]\n", argv[0]);
+    return 2;
+  }
+  int failed = 0;
+
+  loadRandom();
+  runTimings("random orientations");
+  failed += countMismatches() != 0;
+
+  int n = loadTumble();
+  repeatSamples(n);
+  runTimings("tumble through known attitudes");
+  failed += countMismatches() != 0;
+
+  printf("\n");
+  failed += !checkAccuracy("tumble", n, true);
+  if (argc > 1) {
+    n = loadCapture(argv[1]);
+    if (!n) {
+      fprintf(stderr, "%s: no samples\n", argv[1]);
+      return 2;
+    }
+    failed += !checkAccuracy(argv[1], n, false);
+  }
+  return failed != 0;
+}